@@ -0,0 +1,30 @@
+#pragma once
+
+// std::vector with cache-line (64-byte) aligned storage, for arrays the
+// SIMD kernels stream through.
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+template <class T, std::size_t Align = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <class U> struct rebind { using other = AlignedAllocator<U, Align>; };
+
+    AlignedAllocator() = default;
+    template <class U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+    void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t(Align)); }
+
+    template <class U> bool operator==(const AlignedAllocator<U, Align>&) const { return true; }
+    template <class U> bool operator!=(const AlignedAllocator<U, Align>&) const { return false; }
+};
+
+template <class T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
@@ -104,3 +104,15 @@ struct AppState {
     GlTex render_tex;
     GlTex mini_tex;
 };
+
+// Iteration range of the slider and PageUp/PageDown. Past double precision
+// (perturbation or double-double) views need far more iterations, so the
+// cap rises while the last render was one of those.
+constexpr int ITER_MIN      = 64;
+constexpr int ITER_MAX      = 8192;
+constexpr int ITER_MAX_DEEP = 1 << 20;
+
+inline int iter_limit(const AppState& app)
+{
+    return app.renderer.deep_active || app.renderer.dd_active ? ITER_MAX_DEEP : ITER_MAX;
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+// Fixed-point big number for deep-zoom coordinates and reference orbits.
+//
+// Two's complement over LIMBS 32-bit limbs, most significant first: limb 0
+// is the signed integer part, limbs 1..LIMBS-1 the fraction, so the value
+// is limb[0] (signed) + sum limb[k] * 2^(-32k). Fractal coordinates and
+// orbit values stay far below 2^31, so a fixed binary point is all that is
+// needed and add/sub are plain carry chains.
+//
+// mul() takes the number of limbs to keep: a view only needs a few bits
+// beyond its pixel size (bigfix_limbs_for), and the product cost is
+// quadratic in that count.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+struct BigFix {
+    static constexpr int LIMBS = 48;      // 1 integer + 47 fraction limbs (~1e-452)
+    uint32_t limb[LIMBS] = {};
+
+    BigFix() = default;
+    explicit BigFix(double d, int exp = 0) { set_double(d, exp); }
+
+    bool negative() const { return (limb[0] & 0x80000000u) != 0; }
+    bool is_zero() const
+    {
+        for (int k = 0; k < LIMBS; ++k)
+            if (limb[k]) return false;
+        return true;
+    }
+
+    void negate()
+    {
+        uint64_t carry = 1;
+        for (int k = LIMBS - 1; k >= 0; --k) {
+            const uint64_t s = static_cast<uint64_t>(~limb[k]) + carry;
+            limb[k] = static_cast<uint32_t>(s);
+            carry   = s >> 32;
+        }
+    }
+
+    // d * 2^exp; exact for every such value whose magnitude is below 2^31,
+    // bits below the last fraction limb are truncated.
+    void set_double(double d, int exp = 0)
+    {
+        std::fill(limb, limb + LIMBS, 0u);
+        if (d == 0.0 || !std::isfinite(d)) return;
+        int e;
+        const double m = std::frexp(std::abs(d), &e);          // |d| = m * 2^e, m in [0.5, 1)
+        uint64_t mant  = static_cast<uint64_t>(std::ldexp(m, 53));
+        // Bit index of mant's lsb, counting from the lsb of the last limb
+        int shift = e + exp - 53 + 32 * (LIMBS - 1);
+        if (shift < 0) {
+            if (shift <= -64) return;
+            mant >>= -shift;
+            shift = 0;
+        }
+        const unsigned __int128 v = static_cast<unsigned __int128>(mant) << (shift % 32);
+        for (int w = 0; w < 3; ++w) {
+            const int k = LIMBS - 1 - shift / 32 - w;
+            if (k >= 0) limb[k] = static_cast<uint32_t>(v >> (32 * w));
+        }
+        if (d < 0.0) negate();
+    }
+
+    // Nearest double of the top three non-zero limbs (ample for 53 bits)
+    double to_double() const
+    {
+        BigFix a = *this;
+        const bool neg = a.negative();
+        if (neg) a.negate();
+        int k = 0;
+        while (k < LIMBS && a.limb[k] == 0) ++k;
+        double r = 0.0;
+        for (int j = k; j < std::min(k + 3, LIMBS); ++j)
+            r += std::ldexp(static_cast<double>(a.limb[j]), -32 * j);
+        return neg ? -r : r;
+    }
+
+    BigFix& operator+=(const BigFix& b)
+    {
+        uint64_t carry = 0;
+        for (int k = LIMBS - 1; k >= 0; --k) {
+            const uint64_t s = static_cast<uint64_t>(limb[k]) + b.limb[k] + carry;
+            limb[k] = static_cast<uint32_t>(s);
+            carry   = s >> 32;
+        }
+        return *this;
+    }
+
+    BigFix& operator-=(const BigFix& b)
+    {
+        uint64_t borrow = 0;
+        for (int k = LIMBS - 1; k >= 0; --k) {
+            const uint64_t d = static_cast<uint64_t>(limb[k]) - b.limb[k] - borrow;
+            limb[k] = static_cast<uint32_t>(d);
+            borrow  = (d >> 32) & 1u;
+        }
+        return *this;
+    }
+
+    friend BigFix operator+(BigFix a, const BigFix& b) { return a += b; }
+    friend BigFix operator-(BigFix a, const BigFix& b) { return a -= b; }
+    friend BigFix operator-(BigFix a) { a.negate(); return a; }
+
+    friend bool operator==(const BigFix& a, const BigFix& b)
+    {
+        return std::equal(a.limb, a.limb + LIMBS, b.limb);
+    }
+    friend bool operator!=(const BigFix& a, const BigFix& b) { return !(a == b); }
+
+    // a * b keeping the integer limb and the first n-1 fraction limbs
+    // (1 <= n <= LIMBS); the rest of the result is zero. Truncation error is
+    // a few units of limb n-1.
+    static BigFix mul(const BigFix& a, const BigFix& b, int n)
+    {
+        BigFix x = a, y = b;
+        const bool neg = x.negative() != y.negative();
+        if (x.negative()) x.negate();
+        if (y.negative()) y.negate();
+
+        // Columns n..0 of the schoolbook product; column n only feeds the
+        // carry into the last kept limb.
+        BigFix r;
+        const int top = std::min(n, LIMBS - 1);
+        unsigned __int128 carry = 0;
+        for (int k = top; k >= 0; --k) {
+            unsigned __int128 acc = carry;
+            for (int i = 0; i <= k; ++i)
+                acc += static_cast<uint64_t>(x.limb[i]) * y.limb[k - i];
+            if (k < n) r.limb[k] = static_cast<uint32_t>(acc);
+            carry = acc >> 32;
+        }
+        if (neg) r.negate();
+        return r;
+    }
+
+    static BigFix sqr(const BigFix& a, int n) { return mul(a, a, n); }
+
+    // a * 2 (exact)
+    static BigFix twice(const BigFix& a) { return a + a; }
+};
+
+// Limbs a view at pixel scale scale * 2^scale_exp needs: the pixel size
+// plus 64 guard bits for the reference orbit's rounding, capped at the
+// type's capacity.
+inline int bigfix_limbs_for(double scale, int scale_exp = 0)
+{
+    const double bits = -(std::log2(std::max(scale, 1e-300)) + scale_exp) + 64.0;
+    return std::clamp(2 + static_cast<int>(std::ceil(bits / 32.0)), 3, BigFix::LIMBS);
+}
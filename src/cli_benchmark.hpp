@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cpu_renderer.hpp"
+#include "newton.hpp"
 #include "palette.hpp"
 #include "view_state.hpp"
 #include <cstdio>
@@ -24,47 +25,32 @@ inline int run_cli_benchmark()
         bool        julia_mode;
         int         exp_i;
         double      exp_f;
-        bool        force_scalar;
         FractalMode mode;
         int         newton_deg;
     };
 
     const TestCase tests[] = {
-        // AVX path
-        {"Mandelbrot",              FormulaType::Standard,    false, 2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Julia",                   FormulaType::Standard,    true,  2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Burning Ship",            FormulaType::BurningShip, false, 2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Celtic",                  FormulaType::Celtic,      false, 2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Buffalo",                 FormulaType::Buffalo,     false, 2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Mandelbar (n=2)",         FormulaType::Mandelbar,   false, 2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Multibrot (n=3)",         FormulaType::MultiFast,   false, 3, 3.0, false, FractalMode::EscapeTime, 0},
-        {"Multibrot (r=3.5, slow)", FormulaType::MultiSlow,   false, 2, 3.5, false, FractalMode::EscapeTime, 0},
-        {"Collatz",                 FormulaType::Collatz,     false, 2, 2.0, false, FractalMode::EscapeTime, 0},
-        {"Newton (deg 3)",          FormulaType::Standard,    false, 2, 2.0, false, FractalMode::Newton, 3},
-        {"Newton (deg 5)",          FormulaType::Standard,    false, 2, 2.0, false, FractalMode::Newton, 5},
-        // Scalar path
-        {"Mandelbrot",              FormulaType::Standard,    false, 2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Julia",                   FormulaType::Standard,    true,  2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Burning Ship",            FormulaType::BurningShip, false, 2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Celtic",                  FormulaType::Celtic,      false, 2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Buffalo",                 FormulaType::Buffalo,     false, 2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Mandelbar (n=2)",         FormulaType::Mandelbar,   false, 2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Multibrot (n=3)",         FormulaType::MultiFast,   false, 3, 3.0, true,  FractalMode::EscapeTime, 0},
-        {"Multibrot (r=3.5, slow)", FormulaType::MultiSlow,   false, 2, 3.5, true,  FractalMode::EscapeTime, 0},
-        {"Collatz",                 FormulaType::Collatz,     false, 2, 2.0, true,  FractalMode::EscapeTime, 0},
-        {"Newton (deg 3)",          FormulaType::Standard,    false, 2, 2.0, true,  FractalMode::Newton, 3},
-        {"Newton (deg 5)",          FormulaType::Standard,    false, 2, 2.0, true,  FractalMode::Newton, 5},
+        {"Mandelbrot",              FormulaType::Standard,    false, 2, 2.0, FractalMode::EscapeTime, 0},
+        {"Julia",                   FormulaType::Standard,    true,  2, 2.0, FractalMode::EscapeTime, 0},
+        {"Burning Ship",            FormulaType::BurningShip, false, 2, 2.0, FractalMode::EscapeTime, 0},
+        {"Celtic",                  FormulaType::Celtic,      false, 2, 2.0, FractalMode::EscapeTime, 0},
+        {"Buffalo",                 FormulaType::Buffalo,     false, 2, 2.0, FractalMode::EscapeTime, 0},
+        {"Mandelbar (n=2)",         FormulaType::Mandelbar,   false, 2, 2.0, FractalMode::EscapeTime, 0},
+        {"Multibrot (n=3)",         FormulaType::MultiFast,   false, 3, 3.0, FractalMode::EscapeTime, 0},
+        {"Multibrot (r=3.5, slow)", FormulaType::MultiSlow,   false, 2, 3.5, FractalMode::EscapeTime, 0},
+        {"Multibrot (r=3.3, slow)", FormulaType::MultiSlow,   false, 2, 3.3, FractalMode::EscapeTime, 0},
+        {"Collatz",                 FormulaType::Collatz,     false, 2, 2.0, FractalMode::EscapeTime, 0},
+        {"Newton (deg 3)",          FormulaType::Standard,    false, 2, 2.0, FractalMode::Newton, 3},
+        {"Newton (deg 5)",          FormulaType::Standard,    false, 2, 2.0, FractalMode::Newton, 5},
     };
 
-    printf("Fractal Xplorer CLI Benchmark\n");
-    printf("%dx%d, 256 iter, 1 thread, %d runs (avg best %d)\n", W, H, RUNS, BEST_N);
-    printf("AVX supported: %s\n\n", renderer.avx_active ? "yes" : "no");
-    printf("%-30s %-10s %s\n", "Label", "Path", "Mpix/s");
-    printf("------------------------------------------------\n");
-
-    const bool has_avx = renderer.avx_active;
+    // Every tier the CPU can run, widest first
+    const SimdTier tiers[] = {
+        SimdTier::Avx512, SimdTier::Avx2Fma, SimdTier::Avx, SimdTier::Sse2, SimdTier::Scalar
+    };
+    const SimdTier best = renderer.best_tier();
 
-    for (const auto& t : tests) {
+    auto make_view = [](const TestCase& t) {
         ViewState vs;
         vs.center_x        = -0.5;
         vs.center_y        =  0.0;
@@ -84,12 +70,11 @@ inline int run_cli_benchmark()
             newton_init_roots(vs);
             newton_expand_roots(vs);
         }
+        return vs;
+    };
 
-        if (t.force_scalar)
-            renderer.set_avx(false);
-        else
-            renderer.set_avx(has_avx);
-
+    // Mpix/s averaged over the BEST_N fastest of RUNS renders
+    auto measure = [&](const ViewState& vs) {
         // Warm-up
         renderer.render(vs, buf);
 
@@ -102,15 +87,139 @@ inline int run_cli_benchmark()
         double avg_ms = 0.0;
         for (int i = 0; i < BEST_N; ++i) avg_ms += times[i];
         avg_ms /= BEST_N;
-        double mpixs = (W * H) / (avg_ms * 1000.0);
+        return (W * H) / (avg_ms * 1000.0);
+    };
+
+    printf("Fractal Xplorer CLI Benchmark\n");
+    printf("%dx%d, 256 iter, 1 thread, %d runs (avg best %d)\n", W, H, RUNS, BEST_N);
+    printf("Best SIMD tier: %s\n\n", simd_tier_name(best));
+    printf("%-30s %-14s %s\n", "Label", "Path", "Mpix/s");
+    printf("----------------------------------------------------\n");
+
+    // Tier and interleave tables measure the double kernels
+    renderer.set_precision(Precision::Double);
+
+    for (SimdTier tier : tiers) {
+        if (tier > best) continue;   // CPU cannot run this tier
+        renderer.set_tier(tier);
+
+        for (const auto& t : tests) {
+            const double mpixs = measure(make_view(t));
+            printf("%-30s %-14s %6.2f\n", t.label, renderer.path_name(), mpixs);
+        }
+    }
 
-        const char* path_label = "scalar";
-        if (!t.force_scalar && has_avx)
-            path_label = "AVX";
+    // Interleave sweep on the best tier: escape-time kernels carrying
+    // 1..SIMD_MAX_INTERLEAVE independent vector groups per loop iteration
+    if (best != SimdTier::Scalar) {
+        const int saved_g = renderer.interleave();
+        renderer.set_tier(best);
+        printf("\nInterleave sweep (%s)\n", simd_tier_name(best));
+        printf("----------------------------------------------------\n");
+        for (const auto& t : tests) {
+            if (t.mode != FractalMode::EscapeTime) continue;
+            for (int g = 1; g <= SIMD_MAX_INTERLEAVE; ++g) {
+                renderer.set_interleave(g);
+                const double mpixs = measure(make_view(t));
+                char path[32];
+                snprintf(path, sizeof(path), "%s x%d", renderer.path_name(), g);
+                printf("%-30s %-14s %6.2f\n", t.label, path, mpixs);
+            }
+        }
+        renderer.set_interleave(saved_g);
+    }
 
-        printf("%-30s %-10s %6.2f\n", t.label, path_label, mpixs);
+    // Periodicity checking on interior-heavy views: each case renders with
+    // Brent cycle detection off, then on (best tier, double precision)
+    {
+        struct InteriorCase {
+            const char* label;
+            FormulaType formula;
+            bool        julia_mode;
+            int         exp_i;
+            double      cx, cy, width;
+        };
+        const InteriorCase interior[] = {
+            {"Mandelbrot interior",   FormulaType::Standard,  false, 2, -0.25, 0.0, 1.5},
+            {"Julia (rabbit)",        FormulaType::Standard,  true,  2,  0.0,  0.0, 3.0},
+            {"Multibrot (n=3) int.",  FormulaType::MultiFast, false, 3,  0.0,  0.0, 1.5},
+        };
+        constexpr int INTERIOR_ITER = 4096;
+
+        renderer.set_tier(best);
+        printf("\nPeriodicity check (interior-heavy, %d iter, %s)\n",
+               INTERIOR_ITER, renderer.path_name());
+        printf("----------------------------------------------------\n");
+        for (const auto& c : interior) {
+            ViewState vs;
+            vs.formula       = c.formula;
+            vs.julia_mode    = c.julia_mode;
+            vs.julia_re      = -0.123;
+            vs.julia_im      =  0.745;
+            vs.multibrot_exp = c.exp_i;
+            vs.center_x      = c.cx;
+            vs.center_y      = c.cy;
+            vs.view_width    = c.width;
+            vs.max_iter      = INTERIOR_ITER;
+            for (bool per : {false, true}) {
+                vs.periodicity = per;
+                const double mpixs = measure(vs);
+                printf("%-30s %-14s %6.2f\n", c.label, per ? "period on" : "period off", mpixs);
+            }
+        }
+    }
+
+    // Newton root-finding methods: cost per pixel against iterations to
+    // converge (best tier, double precision). Iterations are the mean of
+    // the scalar reference iteration over every 8th pixel in each direction,
+    // counting unconverged pixels at max_iter.
+    {
+        renderer.set_tier(best);
+        printf("\nNewton methods (%s)\n", renderer.path_name());
+        printf("%-30s %-14s %6s %9s\n", "Label", "Method", "Mpix/s", "Avg iter");
+        printf("----------------------------------------------------\n");
+        for (int deg : {3, 5, 8, 16, 32}) {
+            TestCase t = tests[0];
+            t.mode       = FractalMode::Newton;
+            t.newton_deg = deg;
+            char label[32];
+            snprintf(label, sizeof(label), "Newton (deg %d)", deg);
+            for (int m = 0; m < NEWTON_METHOD_COUNT; ++m) {
+                ViewState vs = make_view(t);
+                vs.newton_method = static_cast<NewtonMethod>(m);
+                const double mpixs = measure(vs);
+
+                const double scale = vs.view_width / W;
+                double iters = 0.0;
+                int    count = 0;
+                for (int py = 0; py < H; py += 8)
+                    for (int px = 0; px < W; px += 8, ++count)
+                        iters += newton_iter<false>(vs.center_x + (px - W * 0.5) * scale,
+                                                    vs.center_y + (py - H * 0.5) * scale, vs).smooth;
+                printf("%-30s %-14s %6.2f %9.2f\n", label,
+                       newton_method_name(vs.newton_method), mpixs, iters / count);
+            }
+        }
+    }
+
+    // Single-precision kernels on every SIMD tier (twice the lanes)
+    if (best != SimdTier::Scalar) {
+        renderer.set_precision(Precision::Float);
+        printf("\nFloat32 kernels\n");
+        printf("----------------------------------------------------\n");
+        for (SimdTier tier : tiers) {
+            if (tier > best || tier == SimdTier::Scalar) continue;
+            renderer.set_tier(tier);
+            for (const auto& t : tests) {
+                const double mpixs = measure(make_view(t));
+                char path[32];
+                snprintf(path, sizeof(path), "%s f32", renderer.path_name());
+                printf("%-30s %-14s %6.2f\n", t.label, path, mpixs);
+            }
+        }
     }
 
-    renderer.set_avx(has_avx);  // restore
+    renderer.set_tier(best);  // restore
+    renderer.set_precision(Precision::Auto);
     return 0;
 }
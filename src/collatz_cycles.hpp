@@ -0,0 +1,28 @@
+#pragma once
+
+// Attracting cycles of the Collatz map z -> (2 + 7z - (2+5z)*cos(pi*z)) / 4.
+// An orbit that comes close enough to one of them converges to it and never
+// escapes, so the kernels mark it interior without iterating on. Shared by
+// the scalar kernel and the SIMD stream kernel.
+//
+// All three lie on the real axis: the fixed point 0, the integer cycle
+// 1 -> 4 -> 2 and a 2-cycle near -1, -2 (multipliers 1/2, 3/4 and ≈1/2).
+// Together they account for practically every interior pixel of the
+// default view; the capture radius is far inside each immediate basin.
+
+constexpr double COLLATZ_CYCLE_POINTS[] = {
+    0.0, 1.0, 2.0, 4.0, -0.99426903558532831, -1.9826867122811707
+};
+constexpr double COLLATZ_CYCLE_EPS2 = 1e-6;   // capture radius 1e-3
+
+inline bool collatz_captured(double zr, double zi)
+{
+    const double zi2 = zi * zi;
+    if (zi2 >= COLLATZ_CYCLE_EPS2) return false;
+    for (double p : COLLATZ_CYCLE_POINTS) {
+        const double dr = zr - p;
+        if (dr * dr + zi2 < COLLATZ_CYCLE_EPS2)
+            return true;
+    }
+    return false;
+}
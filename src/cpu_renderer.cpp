@@ -1,21 +1,117 @@
 #include "cpu_renderer.hpp"
 #include "escape_time.hpp"
-#include "escape_time_avx.hpp"
 #include "newton.hpp"
-#include "newton_avx.hpp"
 #include "palette.hpp"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <thread>
 
+// Tile size handed to each thread-pool task
+static constexpr int TILE_W = 64;
+static constexpr int TILE_H = 64;
+
+// Float keeps 24 mantissa bits, so a coordinate of magnitude m is rounded by
+// up to m * 2^-24. Precision::Auto uses the float kernels only while that
+// error stays below 1/F32_PIXEL_MARGIN of a pixel across the whole orbit
+// range (|z| reaches the bailout radius, hence the floor of 2).
+static constexpr double F32_PIXEL_MARGIN = 64.0;
+
+// Same test for double (2^-53): below it Mandelbrot-mode views switch to
+// perturbation, before the image turns blocky, and Julia sets to
+// double-double.
+static constexpr double DEEP_PIXEL_MARGIN = 16.0;
+
+// Extra reference orbits per deep render for glitch correction; each one is
+// a serial high-precision orbit, so regions still glitched after this many
+// keep the last pass's result.
+static constexpr int MAX_GLITCH_REFERENCES = 8;
+
+// Reference orbits cheaper than this are recomputed rather than written to
+// the orbit cache (panning at moderate depth would otherwise churn it)
+static constexpr double ORBIT_CACHE_MIN_MS = 250.0;
+
+// Largest coordinate magnitude the view's orbits reach
+static double coord_extent(const ViewState& vs, int W, int H)
+{
+    const double scale = true_view_width(vs) / W;
+    return std::max({2.0,
+        std::abs(vs.center_x) + 0.5 * W * scale,
+        std::abs(vs.center_y) + 0.5 * H * scale,
+        std::abs(vs.julia_re), std::abs(vs.julia_im)});
+}
+
+static bool float_is_enough(const ViewState& vs, int W, int H)
+{
+    return coord_extent(vs, W, H) * 0x1p-24 * F32_PIXEL_MARGIN <= true_view_width(vs) / W;
+}
+
+static bool double_is_enough(const ViewState& vs, int W, int H)
+{
+    return coord_extent(vs, W, H) * 0x1p-53 * DEEP_PIXEL_MARGIN <= true_view_width(vs) / W;
+}
+
+// Integer exponent of the view's formula: Mandelbar / Multibrot n, integer
+// MultiSlow exponents rounded; 0 for a non-integer MultiSlow exponent and
+// 2 for the other formulas
+static int integer_exponent(const ViewState& vs)
+{
+    switch (vs.formula) {
+        case FormulaType::Mandelbar:
+        case FormulaType::MultiFast:
+            return vs.multibrot_exp;
+        case FormulaType::MultiSlow: {
+            const int n = static_cast<int>(std::round(vs.multibrot_exp_f));
+            return (n >= 2 && std::abs(vs.multibrot_exp_f - n) < 1e-9) ? n : 0;
+        }
+        default:
+            return 2;
+    }
+}
+
+// Views the double-double kernels can render: escape-time with smooth
+// colouring, degree-2 formulas and integer exponents (no Collatz, no
+// polar-form MultiSlow)
+static bool double_double_supported(const ViewState& vs)
+{
+    return vs.mode == FractalMode::EscapeTime && vs.color_mode == COLOR_SMOOTH &&
+           vs.formula != FormulaType::Collatz && integer_exponent(vs) >= 2;
+}
+
+// Views the perturbation path can render: the same formulas in Mandelbrot
+// mode (Lyapunov needs the whole orbit, not just offsets)
+static bool perturbation_supported(const ViewState& vs)
+{
+    return !vs.julia_mode && double_double_supported(vs);
+}
+
+// The view's formula as the reference orbit and the offsets iterate it
+static PerturbFormula perturb_formula(const ViewState& vs)
+{
+    PerturbFormula f;
+    f.power  = integer_exponent(vs);
+    f.abs_re = vs.formula == FormulaType::Celtic || vs.formula == FormulaType::Buffalo;
+    f.abs_im = vs.formula == FormulaType::BurningShip || vs.formula == FormulaType::Buffalo;
+    f.conj   = vs.formula == FormulaType::Mandelbar;
+    return f;
+}
+
 // -----------------------------------------------------------------------
-// Constructor — detect AVX, build thread pool
+// Constructor — pick the widest SIMD tier via CPUID, build thread pool
 // -----------------------------------------------------------------------
 CpuRenderer::CpuRenderer()
 {
-    use_avx    = __builtin_cpu_supports("avx");
-    avx_active = use_avx;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        cpu_tier = SimdTier::Avx512;
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        cpu_tier = SimdTier::Avx2Fma;
+    else if (__builtin_cpu_supports("avx"))
+        cpu_tier = SimdTier::Avx;
+    else if (__builtin_cpu_supports("sse2"))
+        cpu_tier = SimdTier::Sse2;
+    set_tier(cpu_tier);
 
     int n = static_cast<int>(std::thread::hardware_concurrency());
     if (n < 1) n = 4;
@@ -31,6 +127,263 @@ void CpuRenderer::set_thread_count(int n)
     thread_count = n;
 }
 
+void CpuRenderer::set_orbit_cache(const std::string& dir, uint64_t max_bytes)
+{
+    if (dir.empty())
+        orbit_cache.reset();
+    else
+        orbit_cache = std::make_unique<OrbitCache>(dir, max_bytes);
+}
+
+void CpuRenderer::set_tier(SimdTier t)
+{
+    use_tier = std::min(t, cpu_tier);
+    switch (use_tier) {
+        case SimdTier::Avx512:
+            et_kernels[0] = &escape_time_kernels_avx512(use_interleave, false);
+            et_kernels[1] = &escape_time_kernels_avx512(use_interleave, true);
+            nt_kernels        = &newton_kernels_avx512();
+            et_kernels_f32[0] = &escape_time_kernels_f32_avx512(use_interleave, false);
+            et_kernels_f32[1] = &escape_time_kernels_f32_avx512(use_interleave, true);
+            nt_kernels_f32    = &newton_kernels_f32_avx512();
+            pt_kernels        = &perturbation_kernels_avx512(use_interleave);
+            break;
+        case SimdTier::Avx2Fma:
+            et_kernels[0] = &escape_time_kernels_avx2(use_interleave, false);
+            et_kernels[1] = &escape_time_kernels_avx2(use_interleave, true);
+            nt_kernels        = &newton_kernels_avx2();
+            et_kernels_f32[0] = &escape_time_kernels_f32_avx2(use_interleave, false);
+            et_kernels_f32[1] = &escape_time_kernels_f32_avx2(use_interleave, true);
+            nt_kernels_f32    = &newton_kernels_f32_avx2();
+            pt_kernels        = &perturbation_kernels_avx2(use_interleave);
+            break;
+        case SimdTier::Avx:
+            et_kernels[0] = &escape_time_kernels_avx(use_interleave, false);
+            et_kernels[1] = &escape_time_kernels_avx(use_interleave, true);
+            nt_kernels        = &newton_kernels_avx();
+            et_kernels_f32[0] = &escape_time_kernels_f32_avx(use_interleave, false);
+            et_kernels_f32[1] = &escape_time_kernels_f32_avx(use_interleave, true);
+            nt_kernels_f32    = &newton_kernels_f32_avx();
+            pt_kernels        = &perturbation_kernels_avx(use_interleave);
+            break;
+        case SimdTier::Sse2:
+            et_kernels[0] = &escape_time_kernels_sse2(use_interleave, false);
+            et_kernels[1] = &escape_time_kernels_sse2(use_interleave, true);
+            nt_kernels        = &newton_kernels_sse2();
+            et_kernels_f32[0] = &escape_time_kernels_f32_sse2(use_interleave, false);
+            et_kernels_f32[1] = &escape_time_kernels_f32_sse2(use_interleave, true);
+            nt_kernels_f32    = &newton_kernels_f32_sse2();
+            pt_kernels        = &perturbation_kernels_sse2(use_interleave);
+            break;
+        default:
+            et_kernels[0]     = et_kernels[1]     = nullptr;
+            et_kernels_f32[0] = et_kernels_f32[1] = nullptr;
+            nt_kernels        = nullptr;
+            nt_kernels_f32    = nullptr;
+            pt_kernels        = nullptr;
+            break;
+    }
+    active_tier = use_tier;
+}
+
+void CpuRenderer::set_interleave(int g)
+{
+    use_interleave = std::clamp(g, 1, SIMD_MAX_INTERLEAVE);
+    set_tier(use_tier);
+}
+
+// -----------------------------------------------------------------------
+// Escape-time rows. resolve_et_row() maps the view — formula, Julia mode,
+// exponent, colouring, and the tier's table or the scalar kernels — to one
+// row function with its kernel and arguments bound, once per render; tiles
+// call it per row. A new formula registers its kernels here.
+// The SIMD row kernels stream [px, end) in one call (finished lanes are
+// refilled with the next pixel, tails use idle lanes), then the span is
+// coloured.
+// -----------------------------------------------------------------------
+enum class EtSig { Plain, Julia, Exp, ExpJulia, Expf, ExpfJulia };
+
+template<EtSig S>
+static void et_row_simd(const EtRow& r, const ViewState& vs, uint32_t* row,
+                        int px, int end, double x0, double scale, double im)
+{
+    const int n = end - px;
+    double smooth[TILE_W];
+    if constexpr (S == EtSig::Plain)
+        r.plain(x0, scale, px, n, im, r.max_iter, smooth);
+    else if constexpr (S == EtSig::Julia)
+        r.julia(x0, scale, px, n, im, r.max_iter, r.julia_re, r.julia_im, smooth);
+    else if constexpr (S == EtSig::Exp)
+        r.exp(x0, scale, px, n, im, r.max_iter, r.exp_n, smooth);
+    else if constexpr (S == EtSig::ExpJulia)
+        r.exp_julia(x0, scale, px, n, im, r.max_iter, r.exp_n, r.julia_re, r.julia_im, smooth);
+    else if constexpr (S == EtSig::Expf)
+        r.expf(x0, scale, px, n, im, r.max_iter, r.exp_f, smooth);
+    else
+        r.expf_julia(x0, scale, px, n, im, r.max_iter, r.exp_f, r.julia_re, r.julia_im, smooth);
+    for (int k = 0; k < n; ++k)
+        row[px + k] = palette_color(smooth[k], vs.max_iter, vs.palette, vs.pal_offset);
+}
+
+static void et_row_scalar(const EtRow& r, const ViewState& vs, uint32_t* row,
+                          int px, int end, double x0, double scale, double im)
+{
+    for (; px < end; ++px)
+        row[px] = palette_color(r.pixel(r, x0 + px * scale, im),
+                                vs.max_iter, vs.palette, vs.pal_offset);
+}
+
+// Lyapunov colouring: lambda everywhere (Full) or inside the set only
+template<bool Full>
+static uint32_t lyapunov_pixel(const ViewState& vs, double smooth, double lambda)
+{
+    if (Full || smooth >= static_cast<double>(vs.max_iter))
+        return lyapunov_color(lambda, vs.palette, vs.pal_offset);
+    return palette_color(smooth, vs.max_iter, vs.palette, vs.pal_offset);
+}
+
+template<bool Full>
+static void et_row_lyapunov_simd(const EtRow& r, const ViewState& vs, uint32_t* row,
+                                 int px, int end, double x0, double scale, double im)
+{
+    const int n = end - px;
+    double smooth[TILE_W], lyap[TILE_W];
+    r.lyapunov(r.formula, r.julia_mode, x0, scale, px, n, im, r.max_iter, r.exp_n, r.exp_f,
+               r.julia_re, r.julia_im, smooth, lyap);
+    for (int k = 0; k < n; ++k)
+        row[px + k] = lyapunov_pixel<Full>(vs, smooth[k], lyap[k]);
+}
+
+template<bool Full>
+static void et_row_lyapunov_scalar(const EtRow&, const ViewState& vs, uint32_t* row,
+                                   int px, int end, double x0, double scale, double im)
+{
+    for (; px < end; ++px) {
+        const auto [smooth, lambda] = scalar_lyapunov_iter(x0 + px * scale, im, vs);
+        row[px] = lyapunov_pixel<Full>(vs, smooth, lambda);
+    }
+}
+
+// Binds K's row kernel for the view (smooth colouring)
+static void bind_et_simd(EtRow& r, const EscapeTimeKernels& K, const ViewState& vs)
+{
+    const auto quadratic = [&](EtFn m, EtJuliaFn j) {
+        if (r.julia_mode) { r.julia = j; r.row = et_row_simd<EtSig::Julia>; }
+        else              { r.plain = m; r.row = et_row_simd<EtSig::Plain>; }
+    };
+    // Fixed-exponent instances up to ET_FIXED_EXP_MAX
+    const auto integer = [&](const EtExpTable<EtExpFn>& m, const EtExpTable<EtExpJuliaFn>& j) {
+        const int slot = et_exp_slot(r.exp_n);
+        if (r.julia_mode) { r.exp_julia = j[slot]; r.row = et_row_simd<EtSig::ExpJulia>; }
+        else              { r.exp       = m[slot]; r.row = et_row_simd<EtSig::Exp>; }
+    };
+
+    switch (vs.formula) {
+        case FormulaType::BurningShip: quadratic(K.burning_ship, K.burning_ship_julia); break;
+        case FormulaType::Celtic:      quadratic(K.celtic, K.celtic_julia);             break;
+        case FormulaType::Buffalo:     quadratic(K.buffalo, K.buffalo_julia);           break;
+        case FormulaType::Collatz:
+            r.plain = K.collatz;
+            r.row   = et_row_simd<EtSig::Plain>;
+            break;
+        case FormulaType::Mandelbar:
+            if (r.exp_n == 2) quadratic(K.mandelbar, K.mandelbar_julia);
+            else              integer(K.mandelbar_multi, K.mandelbar_multi_julia);
+            break;
+        case FormulaType::MultiFast:
+        case FormulaType::MultiSlow:
+            if (r.exp_n == 2)     quadratic(K.mandelbrot, K.julia);
+            else if (r.exp_n > 2) integer(K.multibrot, K.multijulia);
+            else if (r.julia_mode) { r.expf_julia = K.multijulia_slow; r.row = et_row_simd<EtSig::ExpfJulia>; }
+            else                   { r.expf       = K.multibrot_slow;  r.row = et_row_simd<EtSig::Expf>; }
+            break;
+        default:   // Standard
+            quadratic(K.mandelbrot, K.julia);
+            break;
+    }
+}
+
+// Binds the scalar pixel kernel for the view (smooth colouring)
+static void bind_et_scalar(EtRow& r, const ViewState& vs)
+{
+    using P = EtRow::PixelFn;
+    const auto pick = [&](P m, P j) { r.pixel = r.julia_mode ? j : m; };
+
+    switch (vs.formula) {
+        case FormulaType::BurningShip:
+            pick([](const EtRow& r, double re, double im) { return burning_ship_iter(re, im, r.max_iter, r.periodic, r.per_eps2); },
+                 [](const EtRow& r, double re, double im) { return burning_ship_julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.periodic, r.per_eps2); });
+            break;
+        case FormulaType::Celtic:
+            pick([](const EtRow& r, double re, double im) { return celtic_iter(re, im, r.max_iter, r.periodic, r.per_eps2); },
+                 [](const EtRow& r, double re, double im) { return celtic_julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.periodic, r.per_eps2); });
+            break;
+        case FormulaType::Buffalo:
+            pick([](const EtRow& r, double re, double im) { return buffalo_iter(re, im, r.max_iter, r.periodic, r.per_eps2); },
+                 [](const EtRow& r, double re, double im) { return buffalo_julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.periodic, r.per_eps2); });
+            break;
+        case FormulaType::Collatz:
+            r.pixel = [](const EtRow& r, double re, double im) { return collatz_iter(re, im, r.max_iter, r.periodic, r.per_eps2); };
+            break;
+        case FormulaType::Mandelbar:
+            if (r.exp_n == 2)
+                pick([](const EtRow& r, double re, double im) { return mandelbar_iter(re, im, r.max_iter, r.periodic, r.per_eps2); },
+                     [](const EtRow& r, double re, double im) { return mandelbar_julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.periodic, r.per_eps2); });
+            else
+                pick([](const EtRow& r, double re, double im) { return mandelbar_multi_iter(re, im, r.max_iter, r.exp_n, r.periodic, r.per_eps2); },
+                     [](const EtRow& r, double re, double im) { return mandelbar_multi_julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.exp_n, r.periodic, r.per_eps2); });
+            break;
+        case FormulaType::MultiFast:
+        case FormulaType::MultiSlow:
+            if (r.exp_n == 2)
+                pick([](const EtRow& r, double re, double im) { return mandelbrot_iter(re, im, r.max_iter, r.periodic, r.per_eps2); },
+                     [](const EtRow& r, double re, double im) { return julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.periodic, r.per_eps2); });
+            else if (r.exp_n > 2)
+                pick([](const EtRow& r, double re, double im) { return multibrot_iter(re, im, r.max_iter, r.exp_n, r.periodic, r.per_eps2); },
+                     [](const EtRow& r, double re, double im) { return multijulia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.exp_n, r.periodic, r.per_eps2); });
+            else
+                pick([](const EtRow& r, double re, double im) { return multibrot_slow_iter(re, im, r.max_iter, r.exp_f, r.periodic, r.per_eps2); },
+                     [](const EtRow& r, double re, double im) { return multijulia_slow_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.exp_f, r.periodic, r.per_eps2); });
+            break;
+        default:   // Standard
+            pick([](const EtRow& r, double re, double im) { return mandelbrot_iter(re, im, r.max_iter, r.periodic, r.per_eps2); },
+                 [](const EtRow& r, double re, double im) { return julia_iter(re, im, r.julia_re, r.julia_im, r.max_iter, r.periodic, r.per_eps2); });
+            break;
+    }
+    r.row = et_row_scalar;
+}
+
+// The view's escape-time row function on K's tier (null K: scalar)
+static EtRow resolve_et_row(const EscapeTimeKernels* K, const ViewState& vs, double scale)
+{
+    EtRow r;
+    r.formula    = vs.formula;
+    r.julia_mode = vs.julia_mode;
+    r.periodic   = vs.periodicity;   // Brent cycle detection (smooth colouring)
+    r.per_eps2   = periodicity_eps2(scale);
+    r.max_iter   = vs.max_iter;
+    r.exp_f      = vs.multibrot_exp_f;
+    r.julia_re   = vs.julia_re;
+    r.julia_im   = vs.julia_im;
+
+    if (vs.color_mode != COLOR_SMOOTH && vs.formula != FormulaType::Collatz) {
+        // Lyapunov mode: the kernel computes both smooth and lambda
+        const bool full = vs.color_mode == COLOR_LYAPUNOV_FULL;
+        r.exp_n      = vs.multibrot_exp;
+        r.lyapunov   = K ? K->lyapunov : nullptr;
+        r.row = K ? (full ? et_row_lyapunov_simd<true>   : et_row_lyapunov_simd<false>)
+                  : (full ? et_row_lyapunov_scalar<true> : et_row_lyapunov_scalar<false>);
+        return r;
+    }
+
+    // MultiSlow exponents that are integers take the integer kernels (no
+    // trig); 0 leaves the real-exponent ones
+    r.exp_n = integer_exponent(vs);
+    if (K) bind_et_simd(r, *K, vs);
+    else   bind_et_scalar(r, vs);
+    return r;
+}
+
 // -----------------------------------------------------------------------
 // Tile renderer — called from thread pool workers
 // -----------------------------------------------------------------------
@@ -39,311 +392,353 @@ void CpuRenderer::render_tile(const ViewState& vs, PixelBuffer& buf,
 {
     const int    W     = buf.width;
     const int    H     = buf.height;
-    const double scale = vs.view_width / W;
+    const double scale = true_view_width(vs) / W;
     const double x0    = vs.center_x - W * 0.5 * scale;
     const double y0    = vs.center_y - H * 0.5 * scale;
 
     // ---- Newton mode ----
     if (vs.mode == FractalMode::Newton) {
+        const bool   newton_smooth = (vs.color_mode >= 1);
+        const double band_width    = static_cast<double>(vs.max_iter)
+                                   / static_cast<double>(vs.newton_degree);
+        const auto colour = [&](int root, double smooth) -> uint32_t {
+            if (!newton_smooth)
+                return newton_color(root, static_cast<int>(smooth), vs.max_iter);
+            if (root < 0)
+                return 0xFF000000u;
+            const double ci = std::min(smooth, band_width - 1.0);
+            return palette_color(root * band_width + ci, vs.max_iter,
+                                 vs.palette, vs.pal_offset);
+        };
+
         for (int py = ty; py < ty + th && py < H; ++py) {
             const double im  = y0 + py * scale;
             uint32_t*    row = buf.pixels.data() + py * W;
-            int          px  = tx;
             const int    end = std::min(tx + tw, W);
 
-            const bool newton_smooth = (vs.color_mode >= 1);
-            const double band_width = static_cast<double>(vs.max_iter)
-                                    / static_cast<double>(vs.newton_degree);
-
-            // AVX path: 4 pixels at a time
-            if (use_avx) {
-                for (; px + 4 <= end; px += 4) {
-                    const double re0 = x0 + px * scale;
-                    int root4[4];
-                    double smooth4[4];
-                    if (newton_smooth)
-                        avx_newton_smooth_4(re0, scale, im, vs.max_iter, vs.newton_degree,
-                                     vs.newton_coeffs_re, vs.newton_coeffs_im,
-                                     vs.newton_roots_re, vs.newton_roots_im,
-                                     root4, smooth4);
-                    else
-                        avx_newton_4(re0, scale, im, vs.max_iter, vs.newton_degree,
-                                     vs.newton_coeffs_re, vs.newton_coeffs_im,
-                                     vs.newton_roots_re, vs.newton_roots_im,
-                                     root4, smooth4);
-                    if (newton_smooth) {
-                        for (int k = 0; k < 4; ++k) {
-                            if (root4[k] < 0) {
-                                row[px + k] = 0xFF000000u;
-                            } else {
-                                const double ci = std::min(smooth4[k], band_width - 1.0);
-                                const double s  = root4[k] * band_width + ci;
-                                row[px + k] = palette_color(s, vs.max_iter,
-                                                            vs.palette, vs.pal_offset);
-                            }
-                        }
-                    } else {
-                        for (int k = 0; k < 4; ++k)
-                            row[px + k] = newton_color(root4[k],
-                                              static_cast<int>(smooth4[k]), vs.max_iter);
-                    }
-                }
+            // SIMD path: the whole span in one call, tail lanes masked
+            if (cur_newton) {
+                int    root_n[TILE_W];
+                double smooth_n[TILE_W];
+                cur_newton(x0, scale, tx, end - tx, im, vs.max_iter, vs.newton_degree,
+                           vs.newton_coeffs_re.data(), vs.newton_coeffs_im.data(),
+                           vs.newton_roots_re.data(), vs.newton_roots_im.data(),
+                           vs.newton_trap_r2, root_n, smooth_n);
+                for (int px = tx; px < end; ++px)
+                    row[px] = colour(root_n[px - tx], smooth_n[px - tx]);
+                continue;
             }
 
-            // Scalar remainder (or full row if no AVX)
-            for (; px < end; ++px) {
+            // Scalar path (scalar tier, or no kernel for the view)
+            for (int px = tx; px < end; ++px) {
                 const double re = x0 + px * scale;
-                if (newton_smooth) {
-                    NewtonResult nr = newton_iter<true>(re, im, vs);
-                    if (nr.root < 0) {
-                        row[px] = 0xFF000000u;
-                    } else {
-                        const double ci = std::min(nr.smooth, band_width - 1.0);
-                        const double s  = nr.root * band_width + ci;
-                        row[px] = palette_color(s, vs.max_iter,
-                                                vs.palette, vs.pal_offset);
-                    }
-                } else {
-                    NewtonResult nr = newton_iter<false>(re, im, vs);
-                    row[px] = newton_color(nr.root,
-                                  static_cast<int>(nr.smooth), vs.max_iter);
-                }
+                const NewtonResult nr = newton_smooth ? newton_iter<true>(re, im, vs)
+                                                      : newton_iter<false>(re, im, vs);
+                row[px] = colour(nr.root, nr.smooth);
             }
         }
         return;
     }
 
-    // ---- Escape-time mode ----
+    // ---- Deep zoom (perturbation) ----
+    if (deep_active) {
+        render_tile_deep(vs, buf, tx, ty, tw, th);
+        return;
+    }
 
-    // For MultiSlow: if float exponent is effectively an integer, promote to
-    // the fast integer path (AVX repeated-multiply, no trig).
-    const int slow_int_n = [&]() -> int {
-        if (vs.formula != FormulaType::MultiSlow)
-            return 0;
-        const int n = static_cast<int>(std::round(vs.multibrot_exp_f));
-        return (n >= 2 && std::abs(vs.multibrot_exp_f - n) < 1e-9) ? n : 0;
-    }();
+    // ---- Past double resolution (double-double) ----
+    if (dd_active) {
+        render_tile_dd(vs, buf, tx, ty, tw, th);
+        return;
+    }
 
+    // ---- Escape-time mode ----
     for (int py = ty; py < ty + th && py < H; ++py) {
         const double im  = y0 + py * scale;
         uint32_t*    row = buf.pixels.data() + py * W;
-        int          px  = tx;
-        const int    end = std::min(tx + tw, W);
-
-        // AVX path: 4 pixels per iteration.
-        const bool use_avx_here = use_avx;
-
-        if (use_avx_here) {
-            for (; px + 4 <= end; px += 4) {
-                const double re0 = x0 + px * scale;
-
-                if (vs.color_mode == COLOR_SMOOTH || vs.formula == FormulaType::Collatz) {
-                    double smooth4[4];
-                    switch (vs.formula) {
-                        case FormulaType::Standard:
-                            if (vs.julia_mode)
-                                avx_julia_4(re0, scale, im, vs.max_iter,
-                                             vs.julia_re, vs.julia_im, smooth4);
-                            else
-                                avx_mandelbrot_4(re0, scale, im, vs.max_iter, smooth4);
-                            break;
-                        case FormulaType::BurningShip:
-                            if (vs.julia_mode)
-                                avx_burning_ship_julia_4(re0, scale, im, vs.max_iter,
-                                                          vs.julia_re, vs.julia_im, smooth4);
-                            else
-                                avx_burning_ship_4(re0, scale, im, vs.max_iter, smooth4);
-                            break;
-                        case FormulaType::Mandelbar:
-                            if (vs.julia_mode) {
-                                if (vs.multibrot_exp == 2)
-                                    avx_mandelbar_julia_4(re0, scale, im, vs.max_iter,
-                                                           vs.julia_re, vs.julia_im, smooth4);
-                                else
-                                    avx_mandelbar_multi_julia_4(re0, scale, im, vs.max_iter,
-                                                                  vs.multibrot_exp,
-                                                                  vs.julia_re, vs.julia_im, smooth4);
-                            } else {
-                                if (vs.multibrot_exp == 2)
-                                    avx_mandelbar_4(re0, scale, im, vs.max_iter, smooth4);
-                                else
-                                    avx_mandelbar_multi_4(re0, scale, im, vs.max_iter,
-                                                           vs.multibrot_exp, smooth4);
-                            }
-                            break;
-                        case FormulaType::MultiFast:
-                            if (vs.julia_mode) {
-                                if (vs.multibrot_exp == 2)
-                                    avx_julia_4(re0, scale, im, vs.max_iter,
-                                                 vs.julia_re, vs.julia_im, smooth4);
-                                else
-                                    avx_multijulia_4(re0, scale, im, vs.max_iter,
-                                                      vs.multibrot_exp,
-                                                      vs.julia_re, vs.julia_im, smooth4);
-                            } else {
-                                if (vs.multibrot_exp == 2)
-                                    avx_mandelbrot_4(re0, scale, im, vs.max_iter, smooth4);
-                                else
-                                    avx_multibrot_4(re0, scale, im, vs.max_iter,
-                                                     vs.multibrot_exp, smooth4);
-                            }
-                            break;
-                        case FormulaType::MultiSlow:
-                            if (slow_int_n > 0) {
-                                if (vs.julia_mode) {
-                                    if (slow_int_n == 2)
-                                        avx_julia_4(re0, scale, im, vs.max_iter,
-                                                     vs.julia_re, vs.julia_im, smooth4);
-                                    else
-                                        avx_multijulia_4(re0, scale, im, vs.max_iter,
-                                                          slow_int_n,
-                                                          vs.julia_re, vs.julia_im, smooth4);
-                                } else {
-                                    if (slow_int_n == 2)
-                                        avx_mandelbrot_4(re0, scale, im, vs.max_iter, smooth4);
-                                    else
-                                        avx_multibrot_4(re0, scale, im, vs.max_iter,
-                                                         slow_int_n, smooth4);
-                                }
-                            } else {
-                                if (vs.julia_mode)
-                                    avx_multijulia_slow_4(re0, scale, im, vs.max_iter,
-                                                            vs.multibrot_exp_f,
-                                                            vs.julia_re, vs.julia_im, smooth4);
-                                else
-                                    avx_multibrot_slow_4(re0, scale, im, vs.max_iter,
-                                                           vs.multibrot_exp_f, smooth4);
-                            }
-                            break;
-                        case FormulaType::Celtic:
-                            if (vs.julia_mode)
-                                avx_celtic_julia_4(re0, scale, im, vs.max_iter,
-                                                    vs.julia_re, vs.julia_im, smooth4);
-                            else
-                                avx_celtic_4(re0, scale, im, vs.max_iter, smooth4);
-                            break;
-                        case FormulaType::Buffalo:
-                            if (vs.julia_mode)
-                                avx_buffalo_julia_4(re0, scale, im, vs.max_iter,
-                                                     vs.julia_re, vs.julia_im, smooth4);
-                            else
-                                avx_buffalo_4(re0, scale, im, vs.max_iter, smooth4);
-                            break;
-                        case FormulaType::Collatz:
-                            avx_collatz_4(re0, scale, im, vs.max_iter, smooth4);
-                            break;
-                        default:
-                            avx_mandelbrot_4(re0, scale, im, vs.max_iter, smooth4);
-                            break;
-                    }
-                    for (int k = 0; k < 4; ++k)
-                        row[px + k] = palette_color(smooth4[k], vs.max_iter,
+        cur_et_row(vs, row, tx, std::min(tx + tw, W), x0, scale, im);
+    }
+}
+
+// Perturbation row kernel for the formula ref was computed for
+static void perturb_span_simd(const PerturbationKernels& K, const ReferenceOrbit& ref,
+                              const SeriesApprox& sa, const BlaTable& bla,
+                              const DeepStart* start, double dx0, double scale,
+                              int px, int n, double dy, int max_iter, double glitch_tol,
+                              double* out)
+{
+    const PerturbFormula& f = ref.formula;
+    if (f.power > 2) {
+        (f.conj ? K.mandelbar_multi : K.multibrot)(ref, sa, bla, start, dx0, scale, px, n, dy,
+                                                   max_iter, f.power, glitch_tol, out);
+        return;
+    }
+    const PerturbFn fn = f.conj   ? K.mandelbar
+                       : f.abs_re ? (f.abs_im ? K.buffalo : K.celtic)
+                       : f.abs_im ? K.burning_ship
+                       :            K.mandelbrot;
+    fn(ref, sa, bla, start, dx0, scale, px, n, dy, max_iter, glitch_tol, out);
+}
+
+// Up to TILE_W deep pixels (px + k, offsets dx0 + (px + k) * scale and dy
+// from ref's point, in units of 2^sa.exp) against ref. Past double range
+// the SIMD path runs the floatexp lead-in first (per pixel in scalar for
+// formulas other than z^2 + c) and iterates on from where it handed over.
+void CpuRenderer::deep_span(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                            const BlaTable& bla, double dx0, double scale, int px, int n,
+                            double dy, int max_iter, double glitch_tol, double* out) const
+{
+    const int e = sa.exp;
+    if (pt_kernels) {
+        if (e != 0) {
+            DeepStart start[TILE_W];
+            if (ref.formula.quadratic())
+                pt_kernels->mandelbrot_lead_in(ref, sa, dx0, scale, px, n, dy, max_iter, start);
+            else
+                for (int k = 0; k < n; ++k)
+                    start[k] = perturb_lead_in(ref, sa, dx0 + (px + k) * scale, dy, max_iter);
+            perturb_span_simd(*pt_kernels, ref, sa, bla, start,
+                              std::ldexp(dx0, e), std::ldexp(scale, e), px, n,
+                              std::ldexp(dy, e), max_iter, glitch_tol, out);
+        } else {
+            perturb_span_simd(*pt_kernels, ref, sa, bla, nullptr,
+                              dx0, scale, px, n, dy, max_iter, glitch_tol, out);
+        }
+        return;
+    }
+    for (int k = 0; k < n; ++k)
+        out[k] = perturb_iter(ref, sa, bla, dx0 + (px + k) * scale, dy, max_iter, glitch_tol);
+}
+
+// -----------------------------------------------------------------------
+// Deep-zoom tile: pixels are offsets from the view centre, iterated against
+// ref_orbit from the series skip with BLA steps (all computed for this
+// render before the tiles were queued; the tiles only read them).
+// Offsets are in units of 2^view_exp (= series.exp). Glitched pixels are
+// left for correct_glitches() in this tile's tile_glitches slot.
+// -----------------------------------------------------------------------
+void CpuRenderer::render_tile_deep(const ViewState& vs, PixelBuffer& buf,
+                                   int tx, int ty, int tw, int th)
+{
+    const int    W     = buf.width;
+    const int    H     = buf.height;
+    const double scale = vs.view_width / W;
+    const double dx0   = -W * 0.5 * scale;
+    const double dy0   = -H * 0.5 * scale;
+    std::vector<int>& glitches =
+        tile_glitches[(ty / TILE_H) * ((W + TILE_W - 1) / TILE_W) + tx / TILE_W];
+
+    for (int py = ty; py < ty + th && py < H; ++py) {
+        uint32_t* row = buf.pixels.data() + py * W;
+        const int end = std::min(tx + tw, W);
+
+        double smooth[TILE_W];
+        deep_span(ref_orbit, series, bla, dx0, scale, tx, end - tx, dy0 + py * scale,
+                  vs.max_iter, GLITCH_TOLERANCE, smooth);
+        for (int px = tx; px < end; ++px) {
+            if (smooth[px - tx] == PERTURB_GLITCH)
+                glitches.push_back(py * W + px);
+            else
+                row[px] = palette_color(smooth[px - tx], vs.max_iter,
+                                        vs.palette, vs.pal_offset);
+        }
+    }
+}
+
+// The glitched pixel a new reference goes to: the one nearest the centroid
+// of the largest 4-connected glitched region (pixels sorted row-major)
+static int glitch_reference_pixel(const std::vector<int>& pixels, int W, int H)
+{
+    std::vector<int> label(static_cast<size_t>(W) * H, -1);
+    for (int p : pixels) label[p] = 0;
+
+    int best = pixels.front(), best_size = 0;
+    std::vector<int> stack, region;
+    for (int seed : pixels) {
+        if (label[seed] != 0) continue;
+        label[seed] = 1;
+        stack.assign(1, seed);
+        region.clear();
+        double sx = 0.0, sy = 0.0;
+        while (!stack.empty()) {
+            const int p = stack.back();
+            stack.pop_back();
+            region.push_back(p);
+            const int x = p % W, y = p / W;
+            sx += x;
+            sy += y;
+            const int nb[4] = { x > 0 ? p - 1 : -1, x + 1 < W ? p + 1 : -1,
+                                y > 0 ? p - W : -1, y + 1 < H ? p + W : -1 };
+            for (int q : nb)
+                if (q >= 0 && label[q] == 0) { label[q] = 1; stack.push_back(q); }
+        }
+        if (static_cast<int>(region.size()) <= best_size) continue;
+        best_size = static_cast<int>(region.size());
+        const double cx = sx / best_size, cy = sy / best_size;
+        double best_d = -1.0;
+        for (int p : region) {
+            const double d = (p % W - cx) * (p % W - cx) + (p / W - cy) * (p / W - cy);
+            if (best_d < 0.0 || d < best_d) { best_d = d; best = p; }
+        }
+    }
+    return best;
+}
+
+// Smooth iteration count of a reference's own pixel, read off its orbit
+// (the perturbed offset of that pixel is zero throughout)
+static double reference_smooth(const ReferenceOrbit& ref, int max_iter)
+{
+    if (ref.last >= max_iter) return static_cast<double>(max_iter);
+    const double log_p  = std::log(static_cast<double>(ref.formula.power));
+    const double mag2   = ref.re[ref.last] * ref.re[ref.last] + ref.im[ref.last] * ref.im[ref.last];
+    const double log_zn = std::log(mag2) * 0.5;
+    const double nu     = std::log(log_zn / log_p) / log_p;
+    return std::max(0.0, static_cast<double>(ref.last) + 1.0 - nu);
+}
+
+// -----------------------------------------------------------------------
+// Glitch correction: after the deep tiles, each pass places a new reference
+// inside the largest glitched region and re-renders every pixel still
+// glitched against it, in row slices across the thread pool. The reference
+// pixel itself is coloured from its orbit, since its offset need not come
+// out as exactly zero on every tier, so a pixel is never chosen twice.
+// A pass that fixes nothing besides its reference pixel means the rest
+// of the region diverges from any single nearby orbit (chaotic orbits on
+// the real axis, say), and more references there would each fix about one
+// pixel: the next pass is then the last. The last pass keeps whatever
+// result the pixels get, counted in approximated_pixels.
+// -----------------------------------------------------------------------
+void CpuRenderer::correct_glitches(const ViewState& vs, PixelBuffer& buf)
+{
+    std::vector<int> pending;
+    for (std::vector<int>& t : tile_glitches) {
+        pending.insert(pending.end(), t.begin(), t.end());
+        t.clear();
+    }
+    std::sort(pending.begin(), pending.end());
+    glitched_pixels     = static_cast<int>(pending.size());
+    corrected_pixels    = 0;
+    approximated_pixels = 0;
+    glitch_references   = 0;
+
+    const int    W     = buf.width;
+    const int    H     = buf.height;
+    const double scale = vs.view_width / W;
+    const int    e     = vs.view_exp;
+
+    bool stalled = false;
+    for (int pass = 1; !pending.empty(); ++pass) {
+        const bool   last = stalled || pass == MAX_GLITCH_REFERENCES;
+        const double tol  = last ? 0.0 : GLITCH_TOLERANCE;
+        int&         done = last ? approximated_pixels : corrected_pixels;
+
+        const int gp = glitch_reference_pixel(pending, W, H);
+        const int gx = gp % W, gy = gp / W;
+        compute_reference_orbit(glitch_orbit, ref_orbit.formula,
+                                view_center_re(vs) + BigFix((gx - W * 0.5) * scale, e),
+                                view_center_im(vs) + BigFix((gy - H * 0.5) * scale, e),
+                                vs.max_iter, ref_orbit.limbs);
+        glitch_series     = SeriesApprox();
+        glitch_series.exp = e;
+        compute_bla(glitch_bla, glitch_orbit,
+                    std::ldexp(std::hypot(static_cast<double>(W), static_cast<double>(H)) * scale, e));
+        ++glitch_references;
+
+        // The reference pixel, from the orbit itself
+        buf.pixels[gp] = palette_color(reference_smooth(glitch_orbit, vs.max_iter), vs.max_iter,
+                                       vs.palette, vs.pal_offset);
+        pending.erase(std::lower_bound(pending.begin(), pending.end(), gp));
+        ++done;
+
+        // Slices of whole rows, a few per thread
+        std::vector<size_t> cuts{0};
+        const size_t want = pending.size() / (4 * static_cast<size_t>(thread_count)) + 1;
+        for (size_t i = 1; i < pending.size(); ++i)
+            if (i - cuts.back() >= want && pending[i] / W != pending[i - 1] / W)
+                cuts.push_back(i);
+        cuts.push_back(pending.size());
+
+        const size_t slices = cuts.size() - 1;
+        std::vector<std::vector<int>> still(slices);
+        std::vector<int> fixed(slices, 0);
+        for (size_t sl = 0; sl < slices; ++sl) {
+            pool->submit([&, sl] {
+                double smooth[TILE_W];
+                size_t i = cuts[sl];
+                while (i < cuts[sl + 1]) {
+                    // A run of consecutive pixels on one row, at most TILE_W
+                    size_t j = i + 1;
+                    while (j < cuts[sl + 1] && pending[j] == pending[j - 1] + 1 &&
+                           pending[j] / W == pending[i] / W &&
+                           static_cast<int>(j - i) < TILE_W)
+                        ++j;
+                    const int px = pending[i] % W, py = pending[i] / W;
+                    const int n  = static_cast<int>(j - i);
+                    deep_span(glitch_orbit, glitch_series, glitch_bla, -gx * scale, scale,
+                              px, n, (py - gy) * scale, vs.max_iter, tol, smooth);
+                    uint32_t* row = buf.pixels.data() + py * W;
+                    for (int k = 0; k < n; ++k) {
+                        if (smooth[k] == PERTURB_GLITCH) {
+                            still[sl].push_back(pending[i + k]);
+                            continue;
+                        }
+                        row[px + k] = palette_color(smooth[k], vs.max_iter,
                                                     vs.palette, vs.pal_offset);
-                } else {
-                    // Lyapunov mode: compute both smooth and lambda
-                    double smooth4[4], lyap4[4];
-                    avx_lyapunov_4(vs.formula, vs.julia_mode, re0, scale, im,
-                                     vs.max_iter, vs.multibrot_exp, vs.multibrot_exp_f,
-                                     vs.julia_re, vs.julia_im, smooth4, lyap4);
-                    for (int k = 0; k < 4; ++k) {
-                        if (vs.color_mode == COLOR_LYAPUNOV_FULL)
-                            row[px + k] = lyapunov_color(lyap4[k], vs.palette, vs.pal_offset);
-                        else  // COLOR_LYAPUNOV_INTERIOR
-                            row[px + k] = (smooth4[k] >= static_cast<double>(vs.max_iter))
-                                ? lyapunov_color(lyap4[k], vs.palette, vs.pal_offset)
-                                : palette_color(smooth4[k], vs.max_iter, vs.palette, vs.pal_offset);
+                        ++fixed[sl];
                     }
+                    i = j;
                 }
-            }
+            });
         }
+        pool->wait();
 
-        // Scalar path: remainder pixels (or full row if no AVX)
-        for (; px < end; ++px) {
-            const double re = x0 + px * scale;
-
-            if (vs.color_mode != COLOR_SMOOTH && vs.formula != FormulaType::Collatz) {
-                // Lyapunov mode: compute both smooth and lambda
-                auto [smooth, lambda] = scalar_lyapunov_iter(re, im, vs);
-                if (vs.color_mode == COLOR_LYAPUNOV_FULL)
-                    row[px] = lyapunov_color(lambda, vs.palette, vs.pal_offset);
-                else  // COLOR_LYAPUNOV_INTERIOR
-                    row[px] = (smooth >= static_cast<double>(vs.max_iter))
-                        ? lyapunov_color(lambda, vs.palette, vs.pal_offset)
-                        : palette_color(smooth, vs.max_iter, vs.palette, vs.pal_offset);
-                continue;
-            }
+        int fixed_here = 0;
+        pending.clear();
+        for (size_t sl = 0; sl < slices; ++sl) {
+            pending.insert(pending.end(), still[sl].begin(), still[sl].end());
+            fixed_here += fixed[sl];
+        }
+        done += fixed_here;
+        stalled = fixed_here == 0;
+    }
+}
 
-            double smooth;
-            switch (vs.formula) {
-                case FormulaType::Standard:
-                    smooth = vs.julia_mode
-                        ? julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                        : mandelbrot_iter(re, im, vs.max_iter);
-                    break;
-                case FormulaType::BurningShip:
-                    smooth = vs.julia_mode
-                        ? burning_ship_julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                        : burning_ship_iter(re, im, vs.max_iter);
-                    break;
-                case FormulaType::Mandelbar:
-                    if (vs.julia_mode)
-                        smooth = (vs.multibrot_exp == 2)
-                            ? mandelbar_julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                            : mandelbar_multi_julia_iter(re, im, vs.julia_re, vs.julia_im,
-                                                         vs.max_iter, vs.multibrot_exp);
-                    else
-                        smooth = (vs.multibrot_exp == 2)
-                            ? mandelbar_iter(re, im, vs.max_iter)
-                            : mandelbar_multi_iter(re, im, vs.max_iter, vs.multibrot_exp);
-                    break;
-                case FormulaType::MultiFast:
-                    if (vs.julia_mode)
-                        smooth = (vs.multibrot_exp == 2)
-                            ? julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                            : multijulia_iter(re, im, vs.julia_re, vs.julia_im,
-                                              vs.max_iter, vs.multibrot_exp);
-                    else
-                        smooth = (vs.multibrot_exp == 2)
-                            ? mandelbrot_iter(re, im, vs.max_iter)
-                            : multibrot_iter(re, im, vs.max_iter, vs.multibrot_exp);
-                    break;
-                case FormulaType::MultiSlow:
-                    if (slow_int_n > 0) {
-                        if (vs.julia_mode)
-                            smooth = (slow_int_n == 2)
-                                ? julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                                : multijulia_iter(re, im, vs.julia_re, vs.julia_im,
-                                                  vs.max_iter, slow_int_n);
-                        else
-                            smooth = (slow_int_n == 2)
-                                ? mandelbrot_iter(re, im, vs.max_iter)
-                                : multibrot_iter(re, im, vs.max_iter, slow_int_n);
-                    } else {
-                        smooth = vs.julia_mode
-                            ? multijulia_slow_iter(re, im, vs.julia_re, vs.julia_im,
-                                                   vs.max_iter, vs.multibrot_exp_f)
-                            : multibrot_slow_iter(re, im, vs.max_iter, vs.multibrot_exp_f);
-                    }
-                    break;
-                case FormulaType::Celtic:
-                    smooth = vs.julia_mode
-                        ? celtic_julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                        : celtic_iter(re, im, vs.max_iter);
-                    break;
-                case FormulaType::Buffalo:
-                    smooth = vs.julia_mode
-                        ? buffalo_julia_iter(re, im, vs.julia_re, vs.julia_im, vs.max_iter)
-                        : buffalo_iter(re, im, vs.max_iter);
-                    break;
-                case FormulaType::Collatz:
-                    smooth = collatz_iter(re, im, vs.max_iter);
-                    break;
-                default:
-                    smooth = mandelbrot_iter(re, im, vs.max_iter);
-                    break;
-            }
-            row[px] = palette_color(smooth, vs.max_iter,
-                                    vs.palette, vs.pal_offset);
+// -----------------------------------------------------------------------
+// Double-double tile: same pixel grid as render_tile(), but each row's
+// imaginary part and column 0's real part are taken from the double-double
+// centre, and the kernels iterate in double-double
+// -----------------------------------------------------------------------
+void CpuRenderer::render_tile_dd(const ViewState& vs, PixelBuffer& buf,
+                                 int tx, int ty, int tw, int th)
+{
+    const int     W        = buf.width;
+    const int     H        = buf.height;
+    const double  scale    = true_view_width(vs) / W;
+    const DDouble x0       = view_center_re_dd(vs) + (-W * 0.5 * scale);
+    const DDouble cy       = view_center_im_dd(vs);
+    const double  dy0      = -H * 0.5 * scale;
+    const int     exp_n    = integer_exponent(vs);
+    const double  per_eps2 = periodicity_eps2(scale);
+
+    for (int py = ty; py < ty + th && py < H; ++py) {
+        const DDouble im  = cy + (dy0 + py * scale);
+        uint32_t*     row = buf.pixels.data() + py * W;
+        const int     end = std::min(tx + tw, W);
+
+        if (cur_et) {
+            double smooth[TILE_W];
+            cur_et->double_double(vs.formula, vs.julia_mode, x0.hi, x0.lo, scale, tx, end - tx,
+                                  im.hi, im.lo, vs.max_iter, exp_n,
+                                  vs.julia_re, vs.julia_im, smooth);
+            for (int px = tx; px < end; ++px)
+                row[px] = palette_color(smooth[px - tx], vs.max_iter,
+                                        vs.palette, vs.pal_offset);
+            continue;
+        }
+
+        for (int px = tx; px < end; ++px) {
+            const double smooth = double_double_iter(x0 + px * scale, im, vs, exp_n, per_eps2);
+            row[px] = palette_color(smooth, vs.max_iter, vs.palette, vs.pal_offset);
         }
     }
 }
@@ -353,7 +748,7 @@ void CpuRenderer::render_tile(const ViewState& vs, PixelBuffer& buf,
 // -----------------------------------------------------------------------
 void CpuRenderer::render(const ViewState& vs, PixelBuffer& buf)
 {
-    avx_active = use_avx;
+    active_tier = use_tier;
 
     using clock = std::chrono::steady_clock;
     const auto t0 = clock::now();
@@ -361,19 +756,71 @@ void CpuRenderer::render(const ViewState& vs, PixelBuffer& buf)
     const int W = buf.width, H = buf.height;
     if (W <= 0 || H <= 0) return;
 
-    constexpr int TILE_W = 64;
-    constexpr int TILE_H = 64;
+    // Past double resolution, supported views iterate per-pixel offsets
+    // against one high-precision reference orbit at the centre, starting
+    // where the series approximation leaves off and jumping along the orbit
+    // with the BLA table. Views past double range (view_exp != 0) keep the
+    // pixel scale as a mantissa and exponent and start each pixel's
+    // iteration in FloatExp.
+    const bool deep = perturbation_supported(vs) && !double_is_enough(vs, W, H);
+    if (deep) {
+        const double         scale   = vs.view_width / W;
+        const PerturbFormula formula = perturb_formula(vs);
+        const BigFix         cr      = view_center_re(vs);
+        const BigFix         ci      = view_center_im(vs);
+        const int            limbs   = bigfix_limbs_for(scale, vs.view_exp);
+        if (!ref_orbit.covers(formula, cr, ci, vs.max_iter, limbs)) {
+            // A cached orbit of the same point is used as is or extended
+            orbit_cached = !ref_orbit.same_point(formula, cr, ci, limbs) && orbit_cache &&
+                           orbit_cache->load(ref_orbit, formula, cr, ci, limbs);
+            const auto tr = clock::now();
+            compute_reference_orbit(ref_orbit, formula, cr, ci, vs.max_iter, limbs);
+            if (orbit_cache && std::chrono::duration<double, std::milli>(clock::now() - tr).count() >=
+                               ORBIT_CACHE_MIN_MS)
+                orbit_cache->store(ref_orbit);
+        }
+        series = compute_series(ref_orbit, W, H, scale, vs.view_exp, vs.max_iter);
+        compute_bla(bla, ref_orbit, std::ldexp(series.radius, series.exp));
+    }
+    deep_active = deep;
+    series_skip = deep ? series.skip : 0;
+    if (deep)
+        tile_glitches.resize(static_cast<size_t>((W + TILE_W - 1) / TILE_W) *
+                             ((H + TILE_H - 1) / TILE_H));
+    else
+        glitched_pixels = corrected_pixels = approximated_pixels = glitch_references = 0;
+
+    // Julia sets past double resolution iterate in double-double (Auto
+    // precision only)
+    dd_active = !deep && use_precision == Precision::Auto &&
+                double_double_supported(vs) && !double_is_enough(vs, W, H);
+
+    // Precision is fixed for the whole frame so tiles never mix kernels
+    const bool f32 = !deep && !dd_active && et_kernels_f32[0] &&
+        (use_precision == Precision::Float ||
+         (use_precision == Precision::Auto && float_is_enough(vs, W, H)));
+    cur_et     = (f32 ? et_kernels_f32 : et_kernels)[vs.periodicity ? 1 : 0];
+    cur_nt     = f32 ? nt_kernels_f32 : nt_kernels;
+    cur_newton = (cur_nt && vs.newton_degree >= 2 &&
+                  static_cast<int>(vs.newton_roots_re.size()) == vs.newton_degree)
+               ? newton_kernel(*cur_nt, vs.newton_method, vs.newton_degree,
+                               vs.color_mode >= 1, vs.newton_root_trap)
+               : nullptr;
+    cur_et_row = resolve_et_row(cur_et, vs, true_view_width(vs) / W);
+    f32_active = f32;
 
+    // The tiles finish before render() returns, so they read vs in place
     for (int ty = 0; ty < H; ty += TILE_H) {
         for (int tx = 0; tx < W; tx += TILE_W) {
             const int tw = std::min(TILE_W, W - tx);
             const int th = std::min(TILE_H, H - ty);
-            pool->submit([this, vs, &buf, tx, ty, tw, th] {
+            pool->submit([this, &vs, &buf, tx, ty, tw, th] {
                 render_tile(vs, buf, tx, ty, tw, th);
             });
         }
     }
     pool->wait();
+    if (deep) correct_glitches(vs, buf);
 
     last_render_ms = std::chrono::duration<double, std::milli>(
                          clock::now() - t0).count();
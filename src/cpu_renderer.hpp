@@ -1,10 +1,60 @@
 #pragma once
 
 #include "renderer.hpp"
+#include "perturbation.hpp"
+#include "orbit_cache.hpp"
+#include "simd_dispatch.hpp"
 #include "view_state.hpp"
 #include "thread_pool.hpp"
 
 #include <memory>
+#include <vector>
+
+// Kernel precision: Auto uses the float tables whenever float rounding of the
+// pixel coordinates is invisible at the current scale, and double-double
+// once double rounding is not (see render()).
+enum class Precision { Auto = 0, Double, Float };
+
+// One escape-time row of the current render: the kernel for the view's
+// formula, Julia mode, exponent, colouring and precision, with its arguments
+// bound. Resolved once per render (resolve_et_row() in cpu_renderer.cpp), so
+// the tiles never branch on the view.
+struct EtRow {
+    // Colours row[px, end) at height im
+    using RowFn   = void (*)(const EtRow& r, const ViewState& vs, uint32_t* row,
+                             int px, int end, double x0, double scale, double im);
+    // Smooth iteration count of one pixel (scalar tier)
+    using PixelFn = double (*)(const EtRow& r, double re, double im);
+
+    RowFn row = nullptr;
+
+    // The bound kernel — the one entry matching row's signature
+    EtFn          plain      = nullptr;
+    EtJuliaFn     julia      = nullptr;
+    EtExpFn       exp        = nullptr;
+    EtExpJuliaFn  exp_julia  = nullptr;
+    EtExpfFn      expf       = nullptr;
+    EtExpfJuliaFn expf_julia = nullptr;
+    EtLyapunovFn  lyapunov   = nullptr;
+    PixelFn       pixel      = nullptr;
+
+    // ... and its arguments
+    FormulaType formula    = FormulaType::Standard;
+    bool        julia_mode = false;
+    bool        periodic   = false;
+    double      per_eps2   = PERIODICITY_EPS2;   // scalar cycle radius^2
+    int         max_iter   = 0;
+    int         exp_n      = 2;      // integer exponent (Lyapunov: multibrot_exp)
+    double      exp_f      = 2.0;    // real exponent (MultiSlow)
+    double      julia_re   = 0.0;
+    double      julia_im   = 0.0;
+
+    void operator()(const ViewState& vs, uint32_t* out, int px, int end,
+                    double x0, double scale, double im) const
+    {
+        row(*this, vs, out, px, end, x0, scale, im);
+    }
+};
 
 class CpuRenderer : public IFractalRenderer {
 public:
@@ -12,20 +62,88 @@ public:
     void render(const ViewState& state, PixelBuffer& buf) override;
 
     double last_render_ms = 0.0;
-    bool   avx_active     = false;   // true if AVX path is in use
+    SimdTier active_tier  = SimdTier::Scalar;   // tier used by the last render
+    bool   f32_active     = false;   // last render used the float kernels
+    bool   deep_active    = false;   // last render used perturbation (deep zoom)
+    bool   dd_active      = false;   // last render used the double-double kernels
+    int    series_skip    = 0;       // iterations per pixel skipped by series approximation
+    int    glitched_pixels   = 0;    // deep pixels the glitch test flagged (last render)
+    int    corrected_pixels  = 0;    // ... of those, fixed by an extra reference
+    int    approximated_pixels = 0;  // ... and those the final pass accepted unchecked
+    int    glitch_references = 0;    // extra reference orbits the correction used
+    bool   orbit_cached      = false;  // last deep render's reference came from the orbit cache
     int    thread_count   = 0;
     int    hw_concurrency = 0;       // logical CPU count detected at startup
 
     // n=0 restores hw_concurrency
     void set_thread_count(int n);
 
-    // Override AVX flag (e.g. for benchmarking scalar path)
-    void set_avx(bool b) { use_avx = b; avx_active = b; }
+    // Keep deep-zoom reference orbits in dir (at most max_bytes on disk) and
+    // reuse or extend them across renders and runs; an empty dir turns the
+    // cache off (the default)
+    void set_orbit_cache(const std::string& dir, uint64_t max_bytes);
+
+    // Select the SIMD kernel tier (e.g. for benchmarking narrower paths).
+    // Requests above what the CPU supports are clamped to best_tier().
+    void set_tier(SimdTier t);
+    // set_simd(false) forces the scalar path; set_simd(true) restores best_tier()
+    void set_simd(bool b) { set_tier(b ? cpu_tier : SimdTier::Scalar); }
+
+    // Escape-time interleave factor (1..SIMD_MAX_INTERLEAVE vector groups)
+    void set_interleave(int g);
+    int  interleave() const { return use_interleave; }
+
+    // Auto (default) picks float per render from the pixel scale;
+    // Double / Float force one precision (Float is ignored on the scalar tier)
+    void      set_precision(Precision p) { use_precision = p; }
+    Precision precision() const { return use_precision; }
+
+    SimdTier tier()      const { return use_tier; }
+    SimdTier best_tier() const { return cpu_tier; }   // CPUID result
+
+    // Short label of the active tier: "AVX-512", "AVX2+FMA", "AVX", "SSE2" or "scalar"
+    const char* path_name() const { return simd_tier_name(active_tier); }
 
 private:
     void render_tile(const ViewState& vs, PixelBuffer& buf,
                      int tx, int ty, int tw, int th);
+    void render_tile_deep(const ViewState& vs, PixelBuffer& buf,
+                          int tx, int ty, int tw, int th);
+    void deep_span(const ReferenceOrbit& ref, const SeriesApprox& sa, const BlaTable& bla,
+                   double dx0, double scale, int px, int n, double dy, int max_iter,
+                   double glitch_tol, double* out) const;
+    void correct_glitches(const ViewState& vs, PixelBuffer& buf);
+    void render_tile_dd(const ViewState& vs, PixelBuffer& buf,
+                        int tx, int ty, int tw, int th);
 
     std::unique_ptr<ThreadPool> pool;
-    bool use_avx = false;
+    SimdTier cpu_tier = SimdTier::Scalar;   // detected once at startup
+    SimdTier use_tier = SimdTier::Scalar;
+    int      use_interleave = SIMD_DEFAULT_INTERLEAVE;
+    Precision use_precision = Precision::Auto;
+    // Escape-time tables indexed by ViewState::periodicity; null = scalar only
+    const EscapeTimeKernels* et_kernels[2]     = {};
+    const EscapeTimeKernels* et_kernels_f32[2] = {};
+    const NewtonKernels*     nt_kernels     = nullptr;
+    const NewtonKernels*     nt_kernels_f32 = nullptr;
+    const PerturbationKernels* pt_kernels   = nullptr;
+    // Tables chosen for the current render (double or float)
+    const EscapeTimeKernels* cur_et = nullptr;
+    const NewtonKernels*     cur_nt = nullptr;
+    NewtonFn                 cur_newton = nullptr;   // cur_nt's kernel for the view's degree
+    EtRow                    cur_et_row;             // cur_et's (or scalar) row function for the view
+
+    // Deep-zoom reference orbit at the view centre; rebuilt in render()
+    // (serially, before the tiles start) only when the view needs a new one.
+    // The series and the BLA table are refitted every deep render.
+    ReferenceOrbit ref_orbit;
+    SeriesApprox   series;
+    BlaTable       bla;
+    std::unique_ptr<OrbitCache> orbit_cache;
+    // Glitched pixel indices per tile (each tile task writes only its own
+    // slot), and the extra reference of the current correction pass
+    std::vector<std::vector<int>> tile_glitches;
+    ReferenceOrbit glitch_orbit;
+    SeriesApprox   glitch_series;
+    BlaTable       glitch_bla;
 };
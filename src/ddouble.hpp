@@ -0,0 +1,82 @@
+#pragma once
+
+// Double-double ("dd") arithmetic for the zoom range just past double
+// resolution.
+//
+// A value is the unevaluated sum hi + lo of two doubles with |lo| at most
+// half an ulp of hi: about 106 bits of mantissa at double's exponent range.
+// Everything is built from two error-free transforms:
+//
+//   two_sum(a, b):  s = a + b exactly as s + e (Knuth, 6 flops)
+//   two_prod(a, b): p = a * b exactly as p + e, e = fma(a, b, -p)
+//
+// Additions use the cheap "sloppy" form (hi parts added exactly, lo parts
+// plainly): its error is relative to the larger operand, not the result,
+// which is all an orbit of magnitude ~1 needs.
+//
+// The vector counterpart for the SIMD tiers is DDoubleV in
+// ddouble_simd.hpp.
+
+#include <cmath>
+
+struct DDouble {
+    double hi = 0.0;
+    double lo = 0.0;
+
+    DDouble() = default;
+    DDouble(double h, double l = 0.0) : hi(h), lo(l) {}
+
+    // s + e = a + b exactly
+    static DDouble two_sum(double a, double b)
+    {
+        const double s  = a + b;
+        const double bb = s - a;
+        return { s, (a - (s - bb)) + (b - bb) };
+    }
+    // Same for |a| >= |b|, 3 flops
+    static DDouble quick_two_sum(double a, double b)
+    {
+        const double s = a + b;
+        return { s, b - (s - a) };
+    }
+    // p + e = a * b exactly
+    static DDouble two_prod(double a, double b)
+    {
+        const double p = a * b;
+        return { p, std::fma(a, b, -p) };
+    }
+
+    DDouble operator-() const { return { -hi, -lo }; }
+
+    friend DDouble operator+(const DDouble& a, const DDouble& b)
+    {
+        const DDouble s = two_sum(a.hi, b.hi);
+        return quick_two_sum(s.hi, s.lo + a.lo + b.lo);
+    }
+    friend DDouble operator+(const DDouble& a, double b)
+    {
+        const DDouble s = two_sum(a.hi, b);
+        return quick_two_sum(s.hi, s.lo + a.lo);
+    }
+    friend DDouble operator-(const DDouble& a, const DDouble& b) { return a + (-b); }
+
+    friend DDouble operator*(const DDouble& a, const DDouble& b)
+    {
+        const DDouble p = two_prod(a.hi, b.hi);
+        return quick_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+    }
+    friend DDouble operator*(const DDouble& a, double b)
+    {
+        const DDouble p = two_prod(a.hi, b);
+        return quick_two_sum(p.hi, p.lo + a.lo * b);
+    }
+
+    DDouble sqr() const
+    {
+        const DDouble p = two_prod(hi, hi);
+        return quick_two_sum(p.hi, p.lo + 2.0 * hi * lo);
+    }
+    // Exact: scaling by 2 touches only the exponents
+    DDouble twice() const { return { 2.0 * hi, 2.0 * lo }; }
+    DDouble abs()   const { return hi < 0.0 ? -*this : *this; }
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+// DDoubleV — the SIMD counterpart of DDouble (ddouble.hpp): one hi and one
+// lo double per lane, written against the lane wrappers in simd.hpp
+// (double wrappers only). two_prod takes one fused multiply-subtract where
+// the tier has FMA (V::fused) and falls back to Dekker's split product on
+// SSE2/AVX.
+// Include only from the ISA translation units — never from generic code.
+
+#include "simd.hpp"
+
+namespace {
+
+template<class V>
+struct DDoubleV {
+    using vec = typename V::vec;
+    vec hi;
+    vec lo;
+
+    static DDoubleV from(vec h) { return { h, V::zero() }; }
+    static DDoubleV set1(double h, double l = 0.0) { return { V::set1(h), V::set1(l) }; }
+
+    static DDoubleV two_sum(vec a, vec b)
+    {
+        const vec s  = V::add(a, b);
+        const vec bb = V::sub(s, a);
+        return { s, V::add(V::sub(a, V::sub(s, bb)), V::sub(b, bb)) };
+    }
+    static DDoubleV quick_two_sum(vec a, vec b)
+    {
+        const vec s = V::add(a, b);
+        return { s, V::sub(b, V::sub(s, a)) };
+    }
+    static DDoubleV two_prod(vec a, vec b)
+    {
+        const vec p = V::mul(a, b);
+        if constexpr (V::fused) {
+            return { p, V::fmsub(a, b, p) };
+        } else {
+            // Veltkamp split into 26-bit halves: each partial product is exact
+            const vec split = V::set1(134217729.0);   // 2^27 + 1
+            const vec ta = V::mul(split, a), tb = V::mul(split, b);
+            const vec ah = V::sub(ta, V::sub(ta, a)), al = V::sub(a, ah);
+            const vec bh = V::sub(tb, V::sub(tb, b)), bl = V::sub(b, bh);
+            const vec e  = V::add(V::add(V::add(V::sub(V::mul(ah, bh), p), V::mul(ah, bl)),
+                                         V::mul(al, bh)), V::mul(al, bl));
+            return { p, e };
+        }
+    }
+
+    static DDoubleV neg(const DDoubleV& a) { return { V::neg(a.hi), V::neg(a.lo) }; }
+    static DDoubleV twice(const DDoubleV& a) { return { V::add(a.hi, a.hi), V::add(a.lo, a.lo) }; }
+    static DDoubleV abs(const DDoubleV& a)
+    {
+        const auto m = V::cmp_lt(a.hi, V::zero());
+        return { V::blend(a.hi, V::neg(a.hi), m), V::blend(a.lo, V::neg(a.lo), m) };
+    }
+
+    static DDoubleV add(const DDoubleV& a, const DDoubleV& b)
+    {
+        const DDoubleV s = two_sum(a.hi, b.hi);
+        return quick_two_sum(s.hi, V::add(s.lo, V::add(a.lo, b.lo)));
+    }
+    static DDoubleV add(const DDoubleV& a, vec b)
+    {
+        const DDoubleV s = two_sum(a.hi, b);
+        return quick_two_sum(s.hi, V::add(s.lo, a.lo));
+    }
+    static DDoubleV sub(const DDoubleV& a, const DDoubleV& b) { return add(a, neg(b)); }
+
+    static DDoubleV mul(const DDoubleV& a, const DDoubleV& b)
+    {
+        const DDoubleV p = two_prod(a.hi, b.hi);
+        return quick_two_sum(p.hi, V::add(p.lo, V::fmadd(a.hi, b.lo, V::mul(a.lo, b.hi))));
+    }
+    static DDoubleV sqr(const DDoubleV& a)
+    {
+        const DDoubleV p = two_prod(a.hi, a.hi);
+        return quick_two_sum(p.hi, V::fmadd(V::add(a.hi, a.hi), a.lo, p.lo));
+    }
+
+    static DDoubleV blend(const DDoubleV& a, const DDoubleV& b, typename V::mask m)
+    {
+        return { V::blend(a.hi, b.hi, m), V::blend(a.lo, b.lo, m) };
+    }
+};
+
+} // namespace
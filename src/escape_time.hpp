@@ -2,21 +2,54 @@
 
 #include <cmath>
 #include <vector>
+#include "ddouble.hpp"
 #include "view_state.hpp"
+#include "mandelbrot_interior.hpp"
+#include "collatz_cycles.hpp"
 
 // Returns smooth iteration count for escaped points, or max_iter for interior.
 // Smooth coloring uses the "normalized iteration count" (log-log) formula.
+// periodic = true enables Brent cycle detection: interior orbits that settle
+// into a cycle return max_iter without running to the iteration limit. An
+// orbit counts as cycled once it returns within sqrt(per_eps2) of the saved
+// point; callers pass periodicity_eps2(scale) so deep views keep the radius
+// well below the pixel size.
+
+// Brent periodicity check shared by the scalar kernels (same schedule as the
+// SIMD stream kernel). Seed with z0; call after each update with the number
+// of completed iterations.
+struct PeriodCheck {
+    double sr, si;
+    double eps2;
+    int    check = 1;
+
+    bool cycled(double zr, double zi, int iters)
+    {
+        const double dr = zr - sr, di = zi - si;
+        if (dr*dr + di*di < eps2) return true;
+        if (iters >= check) { sr = zr; si = zi; check *= 2; }
+        return false;
+    }
+};
 
 // Template 1: degree-2 formulas (Standard, BurningShip, Mandelbar n=2, Celtic, Buffalo)
 template<bool IsJulia, bool IsBurningShip, bool IsMandelbar,
          bool AbsRe = false, bool AbsIm = false>
-inline double scalar_kernel(double re, double im, double cr, double ci, int max_iter)
+inline double scalar_kernel(double re, double im, double cr, double ci, int max_iter,
+                            bool periodic = false,
+                            double per_eps2 = PERIODICITY_EPS2)
 {
     double zr = IsJulia ? re : 0.0;
     double zi = IsJulia ? im : 0.0;
     const double c_re = IsJulia ? cr : re;
     const double c_im = IsJulia ? ci : im;
+    PeriodCheck pc{zr, zi, per_eps2};
     const double log2 = std::log(2.0);
+    // Plain Mandelbrot: cardioid / bulb points are interior without iterating
+    if constexpr (!IsJulia && !IsBurningShip && !IsMandelbar && !AbsRe && !AbsIm) {
+        if (mandelbrot_interior(c_re, c_im))
+            return static_cast<double>(max_iter);
+    }
     int i = 0;
     while (i < max_iter) {
         const double zr2 = zr*zr, zi2 = zi*zi;
@@ -39,6 +72,7 @@ inline double scalar_kernel(double re, double im, double cr, double ci, int max_
         zr = new_zr;
         zi = new_zi;
         ++i;
+        if (periodic && pc.cycled(zr, zi, i)) break;
     }
     return static_cast<double>(max_iter);
 }
@@ -46,13 +80,16 @@ inline double scalar_kernel(double re, double im, double cr, double ci, int max_
 // Template 2: integer exponent >= 2 (MultiFast, Mandelbar n>=3)
 template<bool IsJulia, bool IsMandelbar = false>
 inline double scalar_multibrot_kernel(double re, double im, double cr, double ci,
-                                       int max_iter, int n)
+                                       int max_iter, int n, bool periodic = false,
+                                      double per_eps2 = PERIODICITY_EPS2)
 {
     double zr = IsJulia ? re : 0.0;
     double zi = IsJulia ? im : 0.0;
     const double c_re = IsJulia ? cr : re;
     const double c_im = IsJulia ? ci : im;
+    PeriodCheck pc{zr, zi, per_eps2};
     const double log_n = std::log(static_cast<double>(n));
+    const int    top   = 31 - __builtin_clz(static_cast<unsigned>(n));
     int i = 0;
     while (i < max_iter) {
         const double zr2 = zr*zr, zi2 = zi*zi;
@@ -61,29 +98,95 @@ inline double scalar_multibrot_kernel(double re, double im, double cr, double ci
             const double nu     = std::log(log_zn / log_n) / log_n;
             return std::max(0.0, static_cast<double>(i) + 1.0 - nu);
         }
+        // z^n by square-and-multiply, most significant bit first (the
+        // chain the SIMD kernels use)
         double pr = zr, pi = zi;
-        for (int k = 1; k < n; ++k) {
-            const double new_pr = pr*zr - pi*zi;
-            pi = pr*zi + pi*zr;
-            pr = new_pr;
+        for (int b = top - 1; b >= 0; --b) {
+            const double sq_r = pr*pr - pi*pi;
+            pi = (pr + pr)*pi;
+            pr = sq_r;
+            if ((n >> b) & 1) {
+                const double new_pr = pr*zr - pi*zi;
+                pi = pr*zi + pi*zr;
+                pr = new_pr;
+            }
         }
         zr =              pr + c_re;
         zi = (IsMandelbar ? -pi : pi) + c_im;
         ++i;
+        if (periodic && pc.cycled(zr, zi, i)) break;
     }
     return static_cast<double>(max_iter);
 }
 
-// Template 3: real exponent (MultiSlow) via polar form
+// Principal square root of z = (zr, zi) with |z| = m: the larger part
+// sqrt((m + |zr|) / 2) is formed without cancellation, the other follows
+// as zi / (2t). The 1e-300 floor keeps z = 0 finite.
+inline void complex_sqrt(double zr, double zi, double m, double& sr, double& si)
+{
+    const double t = std::max(std::sqrt(0.5 * (m + std::abs(zr))), 1e-300);
+    const double u = zi / (t + t);
+    if (zr >= 0.0) { sr = t;           si = u; }
+    else           { sr = std::abs(u); si = zi < 0.0 ? -t : t; }
+}
+
+// z^r for a MultiSlow exponent with q = multislow_eighths(r) != 0
+// (see there); mag2 = |z|^2, inverse = r < 0
+inline void multislow_dyadic_pow(double zr, double zi, double mag2, int q, bool inverse,
+                                 double& pr, double& pi)
+{
+    // z^whole by square-and-multiply, most significant bit first
+    const int whole = q >> 3, eighths = q & 7;
+    pr = 1.0; pi = 0.0;
+    if (whole > 0) {
+        pr = zr; pi = zi;
+        for (int b = 30 - __builtin_clz(static_cast<unsigned>(whole)); b >= 0; --b) {
+            const double sq_r = pr*pr - pi*pi;
+            pi = (pr + pr)*pi;
+            pr = sq_r;
+            if ((whole >> b) & 1) {
+                const double new_pr = pr*zr - pi*zi;
+                pi = pr*zi + pi*zr;
+                pr = new_pr;
+            }
+        }
+    }
+
+    // z^(1/2), z^(1/4), z^(1/8) in turn, multiplied in where eighths has the bit
+    double sr = zr, si = zi, m2 = mag2;
+    const int levels = 3 - __builtin_ctz(static_cast<unsigned>(eighths));
+    for (int d = 0; d < levels; ++d) {
+        const double m = std::sqrt(m2);
+        complex_sqrt(sr, si, m, sr, si);
+        m2 = m;                                  // |sqrt(s)|^2 = |s|
+        if (eighths & (4 >> d)) {
+            const double new_pr = pr*sr - pi*si;
+            pi = pr*si + pi*sr;
+            pr = new_pr;
+        }
+    }
+
+    if (inverse) {
+        const double inv = 1.0 / (pr*pr + pi*pi);
+        pr *= inv;
+        pi *= -inv;
+    }
+}
+
+// Template 3: real exponent (MultiSlow) via polar form, or
+// multislow_dyadic_pow() when the exponent allows
 template<bool IsJulia>
 inline double scalar_multibrot_slow_kernel(double re, double im, double cr, double ci,
-                                            int max_iter, double n)
+                                            int max_iter, double n, bool periodic = false,
+                                           double per_eps2 = PERIODICITY_EPS2)
 {
     double zr = IsJulia ? re : 0.0;
     double zi = IsJulia ? im : 0.0;
     const double c_re = IsJulia ? cr : re;
     const double c_im = IsJulia ? ci : im;
+    PeriodCheck pc{zr, zi, per_eps2};
     const double log_n = std::log(n);
+    const int    q     = multislow_eighths(n);
     int i = 0;
     while (i < max_iter) {
         const double mag2 = zr*zr + zi*zi;
@@ -93,13 +196,19 @@ inline double scalar_multibrot_slow_kernel(double re, double im, double cr, doub
             return std::max(0.0, static_cast<double>(i) + 1.0 - nu);
         }
         if (mag2 == 0.0) { zr = c_re; zi = c_im; }
-        else {
+        else if (q) {
+            double pr, pi;
+            multislow_dyadic_pow(zr, zi, mag2, q, n < 0.0, pr, pi);
+            zr = pr + c_re;
+            zi = pi + c_im;
+        } else {
             const double r_n   = std::exp(n * std::log(mag2) * 0.5);
             const double theta = std::atan2(zi, zr);
             zr = r_n * std::cos(n * theta) + c_re;
             zi = r_n * std::sin(n * theta) + c_im;
         }
         ++i;
+        if (periodic && pc.cycled(zr, zi, i)) break;
     }
     return static_cast<double>(max_iter);
 }
@@ -110,10 +219,33 @@ inline double scalar_multibrot_slow_kernel(double re, double im, double cr, doub
 //   cos(pi*zr)*cosh(pi*zi) - i*sin(pi*zr)*sinh(pi*zi)
 static constexpr double COLLATZ_BAILOUT2 = 10000.0;
 
-inline double collatz_iter(double re, double im, int max_iter)
+// One Collatz step. sin/cos share their argument (the compiler merges them
+// into one sincos call); cosh/sinh come from a single exp and its reciprocal.
+inline void collatz_step(double zr, double zi, double& new_zr, double& new_zi)
 {
-    double zr = re, zi = im;
     const double pi = 3.14159265358979323846;
+    const double pzr = pi * zr, pzi = pi * zi;
+    const double cos_r = std::cos(pzr), sin_r = std::sin(pzr);
+    const double e_pos = std::exp(pzi), e_neg = 1.0 / e_pos;
+    const double cosh_i = 0.5 * (e_pos + e_neg), sinh_i = 0.5 * (e_pos - e_neg);
+    const double cw_re =  cos_r * cosh_i;
+    const double cw_im = -sin_r * sinh_i;
+
+    // (2 + 5z) * cos(pi*z)
+    const double a_re = 2.0 + 5.0 * zr, a_im = 5.0 * zi;
+    const double prod_re = a_re * cw_re - a_im * cw_im;
+    const double prod_im = a_re * cw_im + a_im * cw_re;
+
+    // f(z) = (2 + 7z - prod) / 4
+    new_zr = (2.0 + 7.0 * zr - prod_re) * 0.25;
+    new_zi = (      7.0 * zi - prod_im) * 0.25;
+}
+
+inline double collatz_iter(double re, double im, int max_iter, bool periodic = false,
+                           double per_eps2 = PERIODICITY_EPS2)
+{
+    double zr = re, zi = im;
+    PeriodCheck pc{zr, zi, per_eps2};
     const double log2 = std::log(2.0);
 
     for (int i = 0; i < max_iter; ++i) {
@@ -123,75 +255,170 @@ inline double collatz_iter(double re, double im, int max_iter)
             return std::max(0.0, static_cast<double>(i) + 1.0 - nu);
         }
 
-        // cos(pi * z) = cos(pi*zr)*cosh(pi*zi) - i*sin(pi*zr)*sinh(pi*zi)
-        const double pzr = pi * zr, pzi = pi * zi;
-        const double cos_r = std::cos(pzr), sin_r = std::sin(pzr);
-        const double cosh_i = std::cosh(pzi), sinh_i = std::sinh(pzi);
-        const double cw_re =  cos_r * cosh_i;
-        const double cw_im = -sin_r * sinh_i;
-
-        // (2 + 5z) * cos(pi*z)
-        const double a_re = 2.0 + 5.0 * zr, a_im = 5.0 * zi;
-        const double prod_re = a_re * cw_re - a_im * cw_im;
-        const double prod_im = a_re * cw_im + a_im * cw_re;
-
-        // f(z) = (2 + 7z - prod) / 4
-        zr = (2.0 + 7.0 * zr - prod_re) * 0.25;
-        zi = (      7.0 * zi - prod_im) * 0.25;
+        collatz_step(zr, zi, zr, zi);
+        if (collatz_captured(zr, zi)) break;
+        if (periodic && pc.cycled(zr, zi, i + 1)) break;
     }
     return static_cast<double>(max_iter);
 }
 
 // Named wrappers — thin one-liners; all call sites unchanged.
-inline double mandelbrot_iter(double re, double im, int max_iter)
-    { return scalar_kernel<false,false,false>(re, im, 0, 0, max_iter); }
-
-inline double julia_iter(double re, double im, double cr, double ci, int max_iter)
-    { return scalar_kernel<true,false,false>(re, im, cr, ci, max_iter); }
-
-inline double mandelbar_iter(double re, double im, int max_iter)
-    { return scalar_kernel<false,false,true>(re, im, 0, 0, max_iter); }
-
-inline double mandelbar_julia_iter(double re, double im, double cr, double ci, int max_iter)
-    { return scalar_kernel<true,false,true>(re, im, cr, ci, max_iter); }
-
-inline double burning_ship_iter(double re, double im, int max_iter)
-    { return scalar_kernel<false,true,false>(re, im, 0, 0, max_iter); }
-
-inline double burning_ship_julia_iter(double re, double im, double cr, double ci, int max_iter)
-    { return scalar_kernel<true,true,false>(re, im, cr, ci, max_iter); }
-
-inline double celtic_iter(double re, double im, int max_iter)
-    { return scalar_kernel<false,false,false,true,false>(re, im, 0, 0, max_iter); }
-
-inline double celtic_julia_iter(double re, double im, double cr, double ci, int max_iter)
-    { return scalar_kernel<true,false,false,true,false>(re, im, cr, ci, max_iter); }
-
-inline double buffalo_iter(double re, double im, int max_iter)
-    { return scalar_kernel<false,false,false,true,true>(re, im, 0, 0, max_iter); }
-
-inline double buffalo_julia_iter(double re, double im, double cr, double ci, int max_iter)
-    { return scalar_kernel<true,false,false,true,true>(re, im, cr, ci, max_iter); }
-
-inline double multibrot_iter(double re, double im, int max_iter, int n)
-    { return scalar_multibrot_kernel<false>(re, im, 0, 0, max_iter, n); }
-
-inline double multijulia_iter(double re, double im, double cr, double ci, int max_iter, int n)
-    { return scalar_multibrot_kernel<true>(re, im, cr, ci, max_iter, n); }
-
-inline double mandelbar_multi_iter(double re, double im, int max_iter, int n)
-    { return scalar_multibrot_kernel<false,true>(re, im, 0, 0, max_iter, n); }
+inline double mandelbrot_iter(double re, double im, int max_iter, bool periodic = false,
+                              double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<false,false,false>(re, im, 0, 0, max_iter, periodic, per_eps2); }
+
+inline double julia_iter(double re, double im, double cr, double ci,
+                         int max_iter, bool periodic = false,
+                         double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<true,false,false>(re, im, cr, ci, max_iter, periodic, per_eps2); }
+
+inline double mandelbar_iter(double re, double im, int max_iter, bool periodic = false,
+                             double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<false,false,true>(re, im, 0, 0, max_iter, periodic, per_eps2); }
+
+inline double mandelbar_julia_iter(double re, double im, double cr, double ci,
+                                   int max_iter, bool periodic = false,
+                                   double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<true,false,true>(re, im, cr, ci, max_iter, periodic, per_eps2); }
+
+inline double burning_ship_iter(double re, double im, int max_iter, bool periodic = false,
+                                double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<false,true,false>(re, im, 0, 0, max_iter, periodic, per_eps2); }
+
+inline double burning_ship_julia_iter(double re, double im, double cr, double ci,
+                                      int max_iter, bool periodic = false,
+                                      double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<true,true,false>(re, im, cr, ci, max_iter, periodic, per_eps2); }
+
+inline double celtic_iter(double re, double im, int max_iter, bool periodic = false,
+                          double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<false,false,false,true,false>(re, im, 0, 0, max_iter, periodic, per_eps2); }
+
+inline double celtic_julia_iter(double re, double im, double cr, double ci,
+                                int max_iter, bool periodic = false,
+                                double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<true,false,false,true,false>(re, im, cr, ci, max_iter, periodic, per_eps2); }
+
+inline double buffalo_iter(double re, double im, int max_iter, bool periodic = false,
+                           double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<false,false,false,true,true>(re, im, 0, 0, max_iter, periodic, per_eps2); }
+
+inline double buffalo_julia_iter(double re, double im, double cr, double ci,
+                                 int max_iter, bool periodic = false,
+                                 double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_kernel<true,false,false,true,true>(re, im, cr, ci, max_iter, periodic, per_eps2); }
+
+inline double multibrot_iter(double re, double im, int max_iter, int n, bool periodic = false,
+                             double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_multibrot_kernel<false>(re, im, 0, 0, max_iter, n, periodic, per_eps2); }
+
+inline double multijulia_iter(double re, double im, double cr, double ci,
+                              int max_iter, int n, bool periodic = false,
+                              double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_multibrot_kernel<true>(re, im, cr, ci, max_iter, n, periodic, per_eps2); }
+
+inline double mandelbar_multi_iter(double re, double im,
+                                   int max_iter, int n, bool periodic = false,
+                                   double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_multibrot_kernel<false,true>(re, im, 0, 0, max_iter, n, periodic, per_eps2); }
 
 inline double mandelbar_multi_julia_iter(double re, double im, double cr, double ci,
-                                          int max_iter, int n)
-    { return scalar_multibrot_kernel<true,true>(re, im, cr, ci, max_iter, n); }
+                                          int max_iter, int n, bool periodic = false,
+                                         double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_multibrot_kernel<true,true>(re, im, cr, ci, max_iter, n, periodic, per_eps2); }
 
-inline double multibrot_slow_iter(double re, double im, int max_iter, double n)
-    { return scalar_multibrot_slow_kernel<false>(re, im, 0, 0, max_iter, n); }
+inline double multibrot_slow_iter(double re, double im,
+                                  int max_iter, double n, bool periodic = false,
+                                  double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_multibrot_slow_kernel<false>(re, im, 0, 0, max_iter, n, periodic, per_eps2); }
 
 inline double multijulia_slow_iter(double re, double im, double cr, double ci,
-                                    int max_iter, double n)
-    { return scalar_multibrot_slow_kernel<true>(re, im, cr, ci, max_iter, n); }
+                                    int max_iter, double n, bool periodic = false,
+                                   double per_eps2 = PERIODICITY_EPS2)
+    { return scalar_multibrot_slow_kernel<true>(re, im, cr, ci, max_iter, n, periodic, per_eps2); }
+
+// Double-double iteration for views just past double resolution (scalar
+// tier; the SIMD tiers use simd_double_double()). Pixel and orbit are
+// DDouble; the periodicity check differences in double-double against
+// per_eps2 (periodicity_eps2(scale)). step(zr, zi, cr, ci) updates z.
+template<bool IsJulia, class Step>
+inline double scalar_dd_kernel(const Step& step, DDouble re, DDouble im, double cr, double ci,
+                               int max_iter, double log_n, bool periodic, double per_eps2)
+{
+    DDouble zr = IsJulia ? re : DDouble();
+    DDouble zi = IsJulia ? im : DDouble();
+    const DDouble c_re = IsJulia ? DDouble(cr) : re;
+    const DDouble c_im = IsJulia ? DDouble(ci) : im;
+    DDouble sr = zr, si = zi;
+    int check = 1;
+    int i = 0;
+    while (i < max_iter) {
+        const double mag2 = zr.hi*zr.hi + zi.hi*zi.hi;
+        if (mag2 > 4.0) {
+            const double log_zn = std::log(mag2) * 0.5;
+            const double nu     = std::log(log_zn / log_n) / log_n;
+            return std::max(0.0, static_cast<double>(i) + 1.0 - nu);
+        }
+        step(zr, zi, c_re, c_im);
+        ++i;
+        if (periodic) {
+            const double dr = (zr - sr).hi, di = (zi - si).hi;
+            if (dr*dr + di*di < per_eps2) break;
+            if (i >= check) { sr = zr; si = zi; check *= 2; }
+        }
+    }
+    return static_cast<double>(max_iter);
+}
+
+// Formula dispatch for scalar_dd_kernel(): the degree-2 formulas and the
+// integer exponents (exp_n, integer MultiSlow already promoted)
+inline double double_double_iter(DDouble re, DDouble im, const ViewState& vs, int exp_n,
+                                 double per_eps2)
+{
+    const bool   per = vs.periodicity;
+    const double cr  = vs.julia_re, ci = vs.julia_im;
+    auto run = [&](auto step, double log_n) {
+        return vs.julia_mode
+            ? scalar_dd_kernel<true>(step, re, im, cr, ci, vs.max_iter, log_n, per, per_eps2)
+            : scalar_dd_kernel<false>(step, re, im, cr, ci, vs.max_iter, log_n, per, per_eps2);
+    };
+    const double log2 = std::log(2.0);
+    const bool   bar  = vs.formula == FormulaType::Mandelbar;
+
+    if (vs.formula == FormulaType::BurningShip)
+        return run([](DDouble& zr, DDouble& zi, const DDouble& c_re, const DDouble& c_im) {
+            const DDouble t = zr.sqr() - zi.sqr() + c_re;
+            zi = (zr.abs() * zi.abs()).twice() + c_im;
+            zr = t;
+        }, log2);
+    if (vs.formula == FormulaType::Celtic || vs.formula == FormulaType::Buffalo) {
+        const bool abs_im = vs.formula == FormulaType::Buffalo;
+        return run([abs_im](DDouble& zr, DDouble& zi, const DDouble& c_re, const DDouble& c_im) {
+            const DDouble t   = (zr.sqr() - zi.sqr()).abs() + c_re;
+            const DDouble im2 = (zr * zi).twice();
+            zi = (abs_im ? im2.abs() : im2) + c_im;
+            zr = t;
+        }, log2);
+    }
+    if ((bar || vs.formula == FormulaType::MultiFast || vs.formula == FormulaType::MultiSlow) &&
+        exp_n > 2)
+        return run([exp_n, bar](DDouble& zr, DDouble& zi, const DDouble& c_re, const DDouble& c_im) {
+            DDouble pr = zr, pi = zi;
+            for (int k = 1; k < exp_n; ++k) {
+                const DDouble new_pr = pr*zr - pi*zi;
+                pi = pr*zi + pi*zr;
+                pr = new_pr;
+            }
+            zr = pr + c_re;
+            zi = (bar ? -pi : pi) + c_im;
+        }, std::log(static_cast<double>(exp_n)));
+    return run([bar](DDouble& zr, DDouble& zi, const DDouble& c_re, const DDouble& c_im) {
+        const DDouble t   = zr.sqr() - zi.sqr() + c_re;
+        const DDouble im2 = (zr * zi).twice();
+        zi = (bar ? -im2 : im2) + c_im;
+        zr = t;
+    }, log2);
+}
 
 // Generic scalar Lyapunov iteration: returns {smooth, lambda} for any formula.
 // lambda = (1/N) * sum(log|f'(z_k)|), where log|f'(z)| = log(n) + (n-1)/2 * log(|z|^2).
@@ -226,16 +453,33 @@ inline SmoothLyapunov scalar_lyapunov_iter(double re, double im, const ViewState
     }();
     const double log_n     = std::log(exp_n);
     const double half_nm1  = (exp_n - 1.0) * 0.5;
-
-    double lyap_sum = 0.0;
-    int    count    = 0;
+    const int    slow_q    = vs.formula == FormulaType::MultiSlow ? multislow_eighths(exp_n) : 0;
+
+    // The sum of log|f'(z)| = log(n) + (n-1)/2 * log(|z|^2) needs only the
+    // sum of log(|z|^2): kept as the product of |z|^2 (mant * 2^exp),
+    // renormalized when mant leaves [2^-64, 2^64] and logged once at the end.
+    // Like the SIMD kernels, |z|^2 <= 1e-200 is left out, which keeps every
+    // factor within range of the product.
+    double lyap_mant = 1.0;
+    int    lyap_exp  = 0;
+    int    count     = 0;
+    const auto lambda = [&] {
+        if (count == 0) return 0.0;
+        const double sum_log_mag2 = std::log(lyap_mant) + lyap_exp * 0.69314718055994531;
+        return (count * log_n + half_nm1 * sum_log_mag2) / count;
+    };
 
     for (int i = 0; i < vs.max_iter; ++i) {
         const double mag2 = zr * zr + zi * zi;
 
-        // Accumulate Lyapunov: log|f'(z)| = log(n) + (n-1)/2 * log(|z|^2)
-        if (mag2 > 0.0) {
-            lyap_sum += log_n + half_nm1 * std::log(mag2);
+        // Accumulate Lyapunov
+        if (mag2 > 1e-200) {
+            lyap_mant *= mag2;
+            if (!(lyap_mant >= 0x1p-64 && lyap_mant <= 0x1p64)) {
+                int e;
+                lyap_mant = std::frexp(lyap_mant, &e);
+                lyap_exp += e;
+            }
             ++count;
         }
 
@@ -245,8 +489,7 @@ inline SmoothLyapunov scalar_lyapunov_iter(double re, double im, const ViewState
             const double log_zn = std::log(mag2) * 0.5;
             const double nu     = std::log(log_zn / log_n) / log_n;
             const double smooth = std::max(0.0, static_cast<double>(i) + 1.0 - nu);
-            const double lambda = (count > 0) ? lyap_sum / count : 0.0;
-            return {smooth, lambda};
+            return {smooth, lambda()};
         }
 
         // z-update per formula
@@ -307,6 +550,10 @@ inline SmoothLyapunov scalar_lyapunov_iter(double re, double im, const ViewState
                 if (mag2 == 0.0) {
                     new_zr = cr;
                     new_zi = ci;
+                } else if (slow_q) {
+                    multislow_dyadic_pow(zr, zi, mag2, slow_q, exp_n < 0.0, new_zr, new_zi);
+                    new_zr += cr;
+                    new_zi += ci;
                 } else {
                     const double r_n   = std::exp(exp_n * std::log(mag2) * 0.5);
                     const double theta = std::atan2(zi, zr);
@@ -315,20 +562,9 @@ inline SmoothLyapunov scalar_lyapunov_iter(double re, double im, const ViewState
                 }
                 break;
             }
-            case FormulaType::Collatz: {
-                const double pi = 3.14159265358979323846;
-                const double pzr = pi * zr, pzi = pi * zi;
-                const double cos_r = std::cos(pzr), sin_r = std::sin(pzr);
-                const double cosh_i = std::cosh(pzi), sinh_i = std::sinh(pzi);
-                const double cw_re =  cos_r * cosh_i;
-                const double cw_im = -sin_r * sinh_i;
-                const double a_re = 2.0 + 5.0 * zr, a_im = 5.0 * zi;
-                const double prod_re = a_re * cw_re - a_im * cw_im;
-                const double prod_im = a_re * cw_im + a_im * cw_re;
-                new_zr = (2.0 + 7.0 * zr - prod_re) * 0.25;
-                new_zi = (      7.0 * zi - prod_im) * 0.25;
+            case FormulaType::Collatz:
+                collatz_step(zr, zi, new_zr, new_zi);
                 break;
-            }
             default:
                 new_zr = cr;
                 new_zi = ci;
@@ -339,8 +575,7 @@ inline SmoothLyapunov scalar_lyapunov_iter(double re, double im, const ViewState
     }
 
     // Interior point
-    const double lambda = (count > 0) ? lyap_sum / count : 0.0;
-    return {static_cast<double>(vs.max_iter), lambda};
+    return {static_cast<double>(vs.max_iter), lambda()};
 }
 
 // Returns up to max_n intermediate z values (stops early on escape).
@@ -424,6 +659,10 @@ compute_orbit(double re, double im, const ViewState& vs, int max_n = 20)
                 if (mag2 == 0.0) {
                     new_zr = cr;
                     new_zi = ci;
+                } else if (const int q = multislow_eighths(n)) {
+                    multislow_dyadic_pow(zr, zi, mag2, q, n < 0.0, new_zr, new_zi);
+                    new_zr += cr;
+                    new_zi += ci;
                 } else {
                     const double r_n   = std::exp(n * std::log(mag2) * 0.5);
                     const double theta = std::atan2(zi, zr);
@@ -432,20 +671,9 @@ compute_orbit(double re, double im, const ViewState& vs, int max_n = 20)
                 }
                 break;
             }
-            case FormulaType::Collatz: {
-                const double pi = 3.14159265358979323846;
-                const double pzr = pi * zr, pzi = pi * zi;
-                const double cos_r = std::cos(pzr), sin_r = std::sin(pzr);
-                const double cosh_i = std::cosh(pzi), sinh_i = std::sinh(pzi);
-                const double cw_re =  cos_r * cosh_i;
-                const double cw_im = -sin_r * sinh_i;
-                const double a_re = 2.0 + 5.0 * zr, a_im = 5.0 * zi;
-                const double prod_re = a_re * cw_re - a_im * cw_im;
-                const double prod_im = a_re * cw_im + a_im * cw_re;
-                new_zr = (2.0 + 7.0 * zr - prod_re) * 0.25;
-                new_zi = (      7.0 * zi - prod_im) * 0.25;
+            case FormulaType::Collatz:
+                collatz_step(zr, zi, new_zr, new_zi);
                 break;
-            }
             default:
                 new_zr = cr;
                 new_zi = ci;
@@ -0,0 +1,265 @@
+// Compiled once per ISA tier with -DSIMD_TIER=<sse2|avx|avx2|avx512> and the
+// matching -m flags (see add_kernel_tier in CMakeLists.txt).
+// Do NOT add to the main source list and do NOT include from other TUs.
+
+#include "simd_dispatch.hpp"
+#include "escape_time_simd.hpp"
+
+#ifndef SIMD_TIER
+#error "escape_time_simd.cpp must be built with -DSIMD_TIER=<tier>"
+#endif
+
+#define SIMD_CAT_(a, b) a##b
+#define SIMD_CAT(a, b)  SIMD_CAT_(a, b)
+
+namespace {
+
+// -----------------------------------------------------------------------
+// Entry points (one per table slot) — every one streams a row span.
+// V is SimdTierV (double) or SimdTierVF (float).
+// -----------------------------------------------------------------------
+
+// G = interleave factor (independent vector groups per loop iteration)
+// P = periodicity checking on/off
+template<class V, int G, bool P, bool IsJulia, class Step>
+void row(const Step& f, double x0, double scale, int px, int n, double im,
+         int max_iter, double c_re, double c_im, double* out)
+{
+    simd_stream_row<V, G, IsJulia, false, P>(f, x0, scale, px, n, im, max_iter, c_re, c_im, out);
+}
+
+template<class V, int G, bool P>
+void mandelbrot(double x0, double scale, int px, int n, double im,
+                int max_iter, double* out)
+{
+    row<V, G, P, false>(QuadraticStep<V, false, false>(), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P>
+void julia(double x0, double scale, int px, int n, double im,
+           int max_iter, double julia_re, double julia_im, double* out)
+{
+    row<V, G, P, true>(QuadraticStep<V, false, false>(), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+}
+
+template<class V, int G, bool P>
+void burning_ship(double x0, double scale, int px, int n, double im,
+                  int max_iter, double* out)
+{
+    row<V, G, P, false>(QuadraticStep<V, true, false>(), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P>
+void burning_ship_julia(double x0, double scale, int px, int n, double im,
+                        int max_iter, double julia_re, double julia_im,
+                        double* out)
+{
+    row<V, G, P, true>(QuadraticStep<V, true, false>(), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+}
+
+template<class V, int G, bool P>
+void mandelbar(double x0, double scale, int px, int n, double im,
+               int max_iter, double* out)
+{
+    row<V, G, P, false>(QuadraticStep<V, false, true>(), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P>
+void mandelbar_julia(double x0, double scale, int px, int n, double im,
+                     int max_iter, double julia_re, double julia_im,
+                     double* out)
+{
+    row<V, G, P, true>(QuadraticStep<V, false, true>(), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+}
+
+// Integer exponents: N = 3..ET_FIXED_EXP_MAX fixes the exponent at compile
+// time (exp_n is then ignored), N = 0 takes exp_n at runtime
+template<class V, int G, bool P, bool IsJulia, bool IsMandelbar, int N>
+void multi_row(double x0, double scale, int px, int n, double im, int max_iter,
+               int exp_n, double julia_re, double julia_im, double* out)
+{
+    if constexpr (N > 0)
+        row<V, G, P, IsJulia>(MultibrotFixedStep<V, IsMandelbar, N>(), x0, scale, px, n, im,
+                              max_iter, julia_re, julia_im, out);
+    else
+        row<V, G, P, IsJulia>(MultibrotStep<V, IsMandelbar>(exp_n), x0, scale, px, n, im,
+                              max_iter, julia_re, julia_im, out);
+}
+
+template<class V, int G, bool P, int N>
+void mandelbar_multi(double x0, double scale, int px, int n, double im,
+                     int max_iter, int exp_n, double* out)
+{
+    multi_row<V, G, P, false, true, N>(x0, scale, px, n, im, max_iter, exp_n, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P, int N>
+void mandelbar_multi_julia(double x0, double scale, int px, int n, double im,
+                           int max_iter, int exp_n,
+                           double julia_re, double julia_im, double* out)
+{
+    multi_row<V, G, P, true, true, N>(x0, scale, px, n, im, max_iter, exp_n, julia_re, julia_im, out);
+}
+
+template<class V, int G, bool P, int N>
+void multibrot(double x0, double scale, int px, int n, double im,
+               int max_iter, int exp_n, double* out)
+{
+    multi_row<V, G, P, false, false, N>(x0, scale, px, n, im, max_iter, exp_n, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P, int N>
+void multijulia(double x0, double scale, int px, int n, double im,
+                int max_iter, int exp_n,
+                double julia_re, double julia_im, double* out)
+{
+    multi_row<V, G, P, true, false, N>(x0, scale, px, n, im, max_iter, exp_n, julia_re, julia_im, out);
+}
+
+// Exponents in eighths take the root-iteration step, the rest polar form
+template<class V, int G, bool P>
+void multibrot_slow(double x0, double scale, int px, int n, double im,
+                    int max_iter, double exp_n, double* out)
+{
+    if (multislow_eighths(exp_n))
+        row<V, G, P, false>(MultibrotDyadicStep<V>(exp_n), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+    else
+        row<V, G, P, false>(MultibrotSlowStep<V>(exp_n), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P>
+void multijulia_slow(double x0, double scale, int px, int n, double im,
+                     int max_iter, double exp_n,
+                     double julia_re, double julia_im, double* out)
+{
+    if (multislow_eighths(exp_n))
+        row<V, G, P, true>(MultibrotDyadicStep<V>(exp_n), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+    else
+        row<V, G, P, true>(MultibrotSlowStep<V>(exp_n), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+}
+
+// -----------------------------------------------------------------------
+// Celtic and Buffalo entry points
+// -----------------------------------------------------------------------
+
+template<class V, int G, bool P>
+void celtic(double x0, double scale, int px, int n, double im,
+            int max_iter, double* out)
+{
+    row<V, G, P, false>(QuadraticStep<V, false, false, true, false>(), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P>
+void celtic_julia(double x0, double scale, int px, int n, double im,
+                  int max_iter, double julia_re, double julia_im, double* out)
+{
+    row<V, G, P, true>(QuadraticStep<V, false, false, true, false>(), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+}
+
+template<class V, int G, bool P>
+void buffalo(double x0, double scale, int px, int n, double im,
+             int max_iter, double* out)
+{
+    row<V, G, P, false>(QuadraticStep<V, false, false, true, true>(), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+template<class V, int G, bool P>
+void buffalo_julia(double x0, double scale, int px, int n, double im,
+                   int max_iter, double julia_re, double julia_im, double* out)
+{
+    row<V, G, P, true>(QuadraticStep<V, false, false, true, true>(), x0, scale, px, n, im, max_iter, julia_re, julia_im, out);
+}
+
+// Collatz: z0 = pixel, no c — driven in Julia form with c = 0
+template<class V, int G, bool P>
+void collatz(double x0, double scale, int px, int n, double im,
+             int max_iter, double* out)
+{
+    row<V, G, P, true>(CollatzStep<V>(), x0, scale, px, n, im, max_iter, 0.0, 0.0, out);
+}
+
+// Lyapunov colouring averages log|f'| over the whole orbit, so it never
+// takes the periodicity shortcut
+template<class V, int G>
+void lyapunov(FormulaType formula, bool julia_mode,
+              double x0, double scale, int px, int n, double im,
+              int max_iter, int exp_i, double exp_f,
+              double julia_re, double julia_im,
+              double* smooth, double* lyap)
+{
+    simd_lyapunov<V, G>(formula, julia_mode, x0, scale, px, n, im, max_iter, exp_i, exp_f,
+                        julia_re, julia_im, smooth, lyap);
+}
+
+template<class V, int G, bool P>
+void double_double(FormulaType formula, bool julia_mode,
+                   double x0_hi, double x0_lo, double scale, int px, int n,
+                   double im_hi, double im_lo, int max_iter, int exp_n,
+                   double julia_re, double julia_im, double* out)
+{
+    simd_double_double<V, G, P>(formula, julia_mode, DDouble(x0_hi, x0_lo), scale, px, n,
+                                DDouble(im_hi, im_lo), max_iter, exp_n, julia_re, julia_im, out);
+}
+
+// Exponent tables (see EtExpTable): slot 0 runtime, 3..8 fixed
+#define ET_EXP_TABLE(fn) \
+    { fn<V, G, P, 0>, nullptr, nullptr, fn<V, G, P, 3>, fn<V, G, P, 4>, \
+      fn<V, G, P, 5>, fn<V, G, P, 6>, fn<V, G, P, 7>, fn<V, G, P, 8> }
+static_assert(ET_FIXED_EXP_MAX == 8, "update ET_EXP_TABLE");
+
+template<class V, int G, bool P>
+const EscapeTimeKernels& table()
+{
+    // Collatz always runs in double: cosh/sinh of pi*Im(z) overflow float
+    // long before |z|^2 reaches its 10000 bailout. Double-double is double
+    // by definition.
+    static const EscapeTimeKernels t = {
+        V::lanes, G,
+        mandelbrot<V, G, P>,      julia<V, G, P>,
+        burning_ship<V, G, P>,    burning_ship_julia<V, G, P>,
+        mandelbar<V, G, P>,       mandelbar_julia<V, G, P>,
+        ET_EXP_TABLE(mandelbar_multi), ET_EXP_TABLE(mandelbar_multi_julia),
+        ET_EXP_TABLE(multibrot),       ET_EXP_TABLE(multijulia),
+        multibrot_slow<V, G, P>,  multijulia_slow<V, G, P>,
+        celtic<V, G, P>,          celtic_julia<V, G, P>,
+        buffalo<V, G, P>,         buffalo_julia<V, G, P>,
+        collatz<SimdTierV, G, P>,
+        lyapunov<V, G>,
+        double_double<SimdTierV, G, P>,
+    };
+    return t;
+}
+
+template<class V, bool P>
+const EscapeTimeKernels& table_g(int interleave)
+{
+    switch (interleave) {
+        case 1:  return table<V, 1, P>();
+        case 2:  return table<V, 2, P>();
+        case 3:  return table<V, 3, P>();
+        default: return table<V, 4, P>();
+    }
+}
+
+template<class V>
+const EscapeTimeKernels& table_for(int interleave, bool periodicity)
+{
+    return periodicity ? table_g<V, true>(interleave) : table_g<V, false>(interleave);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------
+// Exported tables — escape_time_kernels_<tier>(interleave, periodicity) and
+// the single-precision escape_time_kernels_f32_<tier>(interleave, periodicity)
+// -----------------------------------------------------------------------
+
+const EscapeTimeKernels& SIMD_CAT(escape_time_kernels_, SIMD_TIER)(int interleave, bool periodicity)
+{
+    return table_for<SimdTierV>(interleave, periodicity);
+}
+
+const EscapeTimeKernels& SIMD_CAT(escape_time_kernels_f32_, SIMD_TIER)(int interleave, bool periodicity)
+{
+    return table_for<SimdTierVF>(interleave, periodicity);
+}
@@ -0,0 +1,1101 @@
+#pragma once
+
+// Escape-time kernel bodies, written once against the lane wrappers in
+// simd.hpp and instantiated per ISA tier by escape_time_simd.cpp.
+// Include only from the ISA translation units — never from generic code.
+//
+// Each formula is a small step policy (one z -> f(z) update); a single
+// streaming row kernel drives every policy across a span of pixels.
+
+#include "simd.hpp"
+#include "ddouble.hpp"
+#include "ddouble_simd.hpp"
+#include "view_state.hpp"            // FormulaType, multislow_eighths
+#include "simd_dispatch.hpp"         // ET_FIXED_EXP_MAX
+#include "mandelbrot_interior.hpp"   // MANDELBROT_BULBS
+#include "collatz_cycles.hpp"        // COLLATZ_CYCLE_POINTS
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+
+// -----------------------------------------------------------------------
+// Step policies
+//
+// Each policy provides:
+//   bailout2          escape radius squared
+//   log_n, nm1_half   log(n) and (n-1)/2 for smooth colouring and the
+//                     Lyapunov derivative log|f'(z)| = log(n) + (n-1)/2 * log|z|^2
+//   step(...)         one update z -> f(z); zr2/zi2/mag2 are precomputed
+//   interior_test     true if simd_mandelbrot_interior() applies (plain z^2 + c)
+//   cycle_test        true if captured(zr, zi) flags lanes that have fallen
+//                     into an attracting cycle (retired as interior)
+//
+// z update uses V::fmadd — fused on the AVX2+FMA and AVX-512 tiers,
+// plain mul+add on SSE2/AVX.
+// -----------------------------------------------------------------------
+
+// Degree-2 formulas: Standard, Burning Ship, Mandelbar, Celtic, Buffalo
+template<class V, bool IsBurningShip, bool IsMandelbar,
+         bool AbsRe = false, bool AbsIm = false>
+struct QuadraticStep {
+    using vec = typename V::vec;
+    static constexpr double bailout2 = 4.0;
+    static constexpr bool   interior_test = !IsBurningShip && !IsMandelbar && !AbsRe && !AbsIm;
+    static constexpr bool   cycle_test    = false;
+    double log_n    = std::log(2.0);
+    double nm1_half = 0.5;
+
+    void step(vec zr, vec zi, vec zr2, vec zi2, vec /*mag2*/, vec cr, vec ci,
+              vec& new_zr, vec& new_zi) const
+    {
+        if constexpr (IsBurningShip) {
+            const vec azr = V::abs(zr);
+            const vec azi = V::abs(zi);
+            new_zr = V::fmadd(zr, zr, V::sub(cr, V::mul(zi, zi)));  // zr^2 - zi^2 + cr
+            new_zi = V::fmadd(V::add(azr, azr), azi, ci);           // 2|zr||zi| + ci
+        } else if constexpr (AbsRe || AbsIm) {
+            // Celtic (AbsRe only) / Buffalo (AbsRe+AbsIm): abs applied after squaring
+            const vec re_raw = V::sub(zr2, zi2);                  // zr^2 - zi^2
+            const vec im_raw = V::mul(V::add(zr, zr), zi);        // 2*zr*zi
+            new_zr = V::add(AbsRe ? V::abs(re_raw) : re_raw, cr);
+            new_zi = V::add(AbsIm ? V::abs(im_raw) : im_raw, ci);
+        } else {
+            new_zr = V::fmadd(zr, zr, V::sub(cr, V::mul(zi, zi)));  // zr^2 - zi^2 + cr
+            if constexpr (IsMandelbar)
+                new_zi = V::fnmadd(V::add(zr, zr), zi, ci);         // -2*zr*zi + ci
+            else
+                new_zi = V::fmadd(V::add(zr, zr), zi, ci);          //  2*zr*zi + ci
+        }
+    }
+};
+
+// z^N for a compile-time N by square-and-multiply, most significant bit
+// first: square for every further bit, times z where it is set
+// (z^5 = ((z^2)^2) * z, z^6 = (z^2 * z)^2). MultibrotStep and
+// scalar_multibrot_kernel() walk the same chain at runtime.
+template<class V, int N>
+inline void simd_complex_pow(typename V::vec zr, typename V::vec zi,
+                             typename V::vec& pr, typename V::vec& pi)
+{
+    using vec = typename V::vec;
+    if constexpr (N == 1) {
+        pr = zr;
+        pi = zi;
+    } else {
+        vec hr, hi;
+        simd_complex_pow<V, N / 2>(zr, zi, hr, hi);
+        pr = V::fmsub(hr, hr, V::mul(hi, hi));                     // h^2
+        pi = V::mul(V::add(hr, hr), hi);
+        if constexpr (N & 1) {
+            const vec new_pr = V::fmsub(pr, zr, V::mul(pi, zi));   // * z
+            pi = V::fmadd(pr, zi, V::mul(pi, zr));
+            pr = new_pr;
+        }
+    }
+}
+
+// log(n) for the fixed exponents, so smooth colouring and the Lyapunov
+// derivative need no log() when the policy is built
+constexpr double MULTIBROT_LOG_N[] = {
+    0.0, 0.0,
+    0.69314718055994531, 1.0986122886681098, 1.3862943611198906,
+    1.6094379124341003,  1.7917594692280550, 1.9459101090932196,
+    2.0794415416798357,
+};
+
+// Integer-exponent Multibrot/Multijulia with the exponent fixed at compile
+// time (3..ET_FIXED_EXP_MAX): z^N by an unrolled square-and-multiply chain.
+template<class V, bool IsMandelbar, int N>
+struct MultibrotFixedStep {
+    using vec = typename V::vec;
+    static_assert(N >= 3 && N < static_cast<int>(std::size(MULTIBROT_LOG_N)),
+                  "no log(n) constant for this exponent");
+    static constexpr double bailout2 = 4.0;
+    static constexpr bool   interior_test = false;
+    static constexpr bool   cycle_test    = false;
+    static constexpr double log_n    = MULTIBROT_LOG_N[N];
+    static constexpr double nm1_half = (N - 1) / 2.0;
+
+    void step(vec zr, vec zi, vec, vec, vec, vec cr, vec ci,
+              vec& new_zr, vec& new_zi) const
+    {
+        vec pw_r, pw_i;
+        simd_complex_pow<V, N>(zr, zi, pw_r, pw_i);
+
+        if constexpr (IsMandelbar)
+            pw_i = V::neg(pw_i);  // conj(z^n): negate imag part
+
+        new_zr = V::add(pw_r, cr);
+        new_zi = V::add(pw_i, ci);
+    }
+};
+
+// Integer-exponent Multibrot/Multijulia for any exp_n >= 3 (the tables use
+// it past ET_FIXED_EXP_MAX). z^n by the square-and-multiply chain of
+// simd_complex_pow(), walked at runtime — no trig.
+template<class V, bool IsMandelbar = false>
+struct MultibrotStep {
+    using vec = typename V::vec;
+    static constexpr double bailout2 = 4.0;
+    static constexpr bool   interior_test = false;
+    static constexpr bool   cycle_test    = false;
+    int    exp_n;
+    int    top_bit;
+    double log_n;
+    double nm1_half;
+
+    explicit MultibrotStep(int n)
+        : exp_n(n), top_bit(31 - __builtin_clz(static_cast<unsigned>(n))),
+          log_n(std::log(static_cast<double>(n))), nm1_half((n - 1) / 2.0) {}
+
+    void step(vec zr, vec zi, vec, vec, vec, vec cr, vec ci,
+              vec& new_zr, vec& new_zi) const
+    {
+        vec pw_r = zr, pw_i = zi;
+        for (int b = top_bit - 1; b >= 0; --b) {
+            const vec sq_r = V::fmsub(pw_r, pw_r, V::mul(pw_i, pw_i));
+            pw_i = V::mul(V::add(pw_r, pw_r), pw_i);
+            pw_r = sq_r;
+            if ((exp_n >> b) & 1) {
+                const vec new_pr = V::fmsub(pw_r, zr, V::mul(pw_i, zi));
+                pw_i = V::fmadd(pw_r, zi, V::mul(pw_i, zr));
+                pw_r = new_pr;
+            }
+        }
+
+        if constexpr (IsMandelbar)
+            pw_i = V::neg(pw_i);  // conj(z^n): negate imag part
+
+        new_zr = V::add(pw_r, cr);
+        new_zi = V::add(pw_i, ci);
+    }
+};
+
+// Calls fn with the z^n policy for integer exponent n >= 3: a fixed-exponent
+// one up to ET_FIXED_EXP_MAX, MultibrotStep beyond
+template<class V, bool IsMandelbar, class Fn>
+void with_multibrot_step(int n, Fn&& fn)
+{
+    static_assert(ET_FIXED_EXP_MAX == 8, "update the cases below");
+    switch (n) {
+        case 3:  fn(MultibrotFixedStep<V, IsMandelbar, 3>()); break;
+        case 4:  fn(MultibrotFixedStep<V, IsMandelbar, 4>()); break;
+        case 5:  fn(MultibrotFixedStep<V, IsMandelbar, 5>()); break;
+        case 6:  fn(MultibrotFixedStep<V, IsMandelbar, 6>()); break;
+        case 7:  fn(MultibrotFixedStep<V, IsMandelbar, 7>()); break;
+        case 8:  fn(MultibrotFixedStep<V, IsMandelbar, 8>()); break;
+        default: fn(MultibrotStep<V, IsMandelbar>(n));       break;
+    }
+}
+
+// Real-exponent Multibrot/Multijulia (MultiSlow).
+// Uses polar form: z^n = |z|^n * e^(i*n*theta), vectorized with SLEEF.
+template<class V>
+struct MultibrotSlowStep {
+    using vec = typename V::vec;
+    static constexpr double bailout2 = 4.0;
+    static constexpr bool   interior_test = false;
+    static constexpr bool   cycle_test    = false;
+    double log_n;
+    double nm1_half;
+    vec    exp_v;
+    vec    half;
+
+    explicit MultibrotSlowStep(double n)
+        : log_n(std::log(n)), nm1_half((n - 1.0) / 2.0),
+          exp_v(V::set1(n)), half(V::set1(0.5)) {}
+
+    void step(vec zr, vec zi, vec, vec, vec mag2, vec cr, vec ci,
+              vec& new_zr, vec& new_zi) const
+    {
+        // z^n via polar form: r_n = |z|^n, theta = arg(z)
+        const vec log_mag = V::mul(V::log(mag2), half);
+        const vec r_n     = V::exp(V::mul(exp_v, log_mag));
+        const vec theta   = V::atan2(zi, zr);
+        vec sin_nt, cos_nt;
+        V::sincos(V::mul(exp_v, theta), sin_nt, cos_nt);
+        new_zr = V::fmadd(r_n, cos_nt, cr);
+        new_zi = V::fmadd(r_n, sin_nt, ci);
+    }
+};
+
+// Principal square root per lane, |z| = m given; the SIMD form of
+// complex_sqrt() in escape_time.hpp
+template<class V>
+inline void simd_complex_sqrt(typename V::vec zr, typename V::vec zi, typename V::vec m,
+                              typename V::vec& sr, typename V::vec& si)
+{
+    using vec = typename V::vec;
+    const vec t = V::max(V::sqrt(V::mul(V::set1(0.5), V::add(m, V::abs(zr)))),
+                         V::set1(sizeof(typename V::scalar) == 8 ? 1e-300 : 1e-30));
+    const vec u = V::div(zi, V::add(t, t));
+    const auto right = V::cmp_ge(zr, V::zero());
+    sr = V::blend(V::abs(u), t, right);
+    si = V::blend(V::blend(t, V::neg(t), V::cmp_lt(zi, V::zero())), u, right);
+}
+
+// MultiSlow with an exponent in eighths (multislow_eighths() != 0):
+// z^whole by the runtime square-and-multiply chain, z^(eighths/8) by up to
+// three principal square roots — no SLEEF, and on the polar form's branch.
+template<class V>
+struct MultibrotDyadicStep {
+    using vec = typename V::vec;
+    static constexpr double bailout2 = 4.0;
+    static constexpr bool   interior_test = false;
+    static constexpr bool   cycle_test    = false;
+    double log_n;
+    double nm1_half;
+    int    whole;
+    int    top_bit;    // of whole, -1 when whole == 0
+    int    eighths;
+    int    levels;     // square roots taken: 3 - ctz(eighths)
+    bool   inverse;
+
+    explicit MultibrotDyadicStep(double n)
+        : log_n(std::log(n)), nm1_half((n - 1.0) / 2.0),
+          whole(multislow_eighths(n) >> 3),
+          top_bit(whole ? 31 - __builtin_clz(static_cast<unsigned>(whole)) : -1),
+          eighths(multislow_eighths(n) & 7),
+          levels(3 - __builtin_ctz(static_cast<unsigned>(eighths))),
+          inverse(n < 0.0) {}
+
+    void step(vec zr, vec zi, vec, vec, vec mag2, vec cr, vec ci,
+              vec& new_zr, vec& new_zi) const
+    {
+        vec pw_r = V::set1(1.0), pw_i = V::zero();
+        if (whole) {
+            pw_r = zr;
+            pw_i = zi;
+            for (int b = top_bit - 1; b >= 0; --b) {
+                const vec sq_r = V::fmsub(pw_r, pw_r, V::mul(pw_i, pw_i));
+                pw_i = V::mul(V::add(pw_r, pw_r), pw_i);
+                pw_r = sq_r;
+                if ((whole >> b) & 1) {
+                    const vec new_pr = V::fmsub(pw_r, zr, V::mul(pw_i, zi));
+                    pw_i = V::fmadd(pw_r, zi, V::mul(pw_i, zr));
+                    pw_r = new_pr;
+                }
+            }
+        }
+
+        vec sr = zr, si = zi, m2 = mag2;
+        for (int d = 0; d < levels; ++d) {
+            const vec m = V::sqrt(m2);
+            simd_complex_sqrt<V>(sr, si, m, sr, si);
+            m2 = m;                                  // |sqrt(s)|^2 = |s|
+            if (eighths & (4 >> d)) {
+                const vec new_pr = V::fmsub(pw_r, sr, V::mul(pw_i, si));
+                pw_i = V::fmadd(pw_r, si, V::mul(pw_i, sr));
+                pw_r = new_pr;
+            }
+        }
+
+        if (inverse) {
+            const vec inv = V::div(V::set1(1.0), V::fmadd(pw_r, pw_r, V::mul(pw_i, pw_i)));
+            pw_r = V::mul(pw_r, inv);
+            pw_i = V::neg(V::mul(pw_i, inv));
+        }
+
+        new_zr = V::add(pw_r, cr);
+        new_zi = V::add(pw_i, ci);
+    }
+};
+
+// Collatz fractal: z -> (2 + 7z - (2+5z)*cos(pi*z)) / 4
+// z0 = pixel, no c parameter (drive with IsJulia = true, c = 0).
+// cos(pi*z) for complex z: cos(pi*zr)*cosh(pi*zi) - i*sin(pi*zr)*sinh(pi*zi)
+// One SLEEF sincos for the real part; cosh/sinh from one exp and its
+// reciprocal: cosh(x) = (e^x + e^-x)/2, sinh(x) = (e^x - e^-x)/2.
+// Lanes that reach an attracting cycle (collatz_captured()) are interior.
+// Smooth colouring and Lyapunov use the n=2 approximation.
+template<class V>
+struct CollatzStep {
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    static constexpr double bailout2 = 10000.0;
+    static constexpr bool   interior_test = false;
+    static constexpr bool   cycle_test    = true;
+    double log_n    = std::log(2.0);
+    double nm1_half = 0.5;
+
+    void step(vec zr, vec zi, vec, vec, vec, vec, vec,
+              vec& new_zr, vec& new_zi) const
+    {
+        const vec two     = V::set1(2.0);
+        const vec five    = V::set1(5.0);
+        const vec seven   = V::set1(7.0);
+        const vec quarter = V::set1(0.25);
+        const vec half    = V::set1(0.5);
+        const vec pi_v    = V::set1(3.14159265358979323846);
+
+        // pi * z
+        const vec pzr = V::mul(pi_v, zr);
+        const vec pzi = V::mul(pi_v, zi);
+
+        // sin(pi*zr), cos(pi*zr) via SLEEF
+        vec sin_r, cos_r;
+        V::sincos(pzr, sin_r, cos_r);
+
+        // cosh(pi*zi), sinh(pi*zi) from exp(pi*zi) and exp(-pi*zi) = 1 / exp(pi*zi)
+        const vec exp_pos = V::exp(pzi);
+        const vec exp_neg = V::div(V::set1(1.0), exp_pos);
+        const vec cosh_i  = V::mul(V::add(exp_pos, exp_neg), half);
+        const vec sinh_i  = V::mul(V::sub(exp_pos, exp_neg), half);
+
+        // cos(pi*z) = cos_r*cosh_i - i*sin_r*sinh_i
+        const vec cw_re = V::mul(cos_r, cosh_i);
+        const vec cw_im = V::neg(V::mul(sin_r, sinh_i));
+
+        // (2 + 5z) * cos(pi*z)
+        const vec a_re    = V::fmadd(five, zr, two);
+        const vec a_im    = V::mul(five, zi);
+        const vec prod_re = V::fmsub(a_re, cw_re, V::mul(a_im, cw_im));
+        const vec prod_im = V::fmadd(a_re, cw_im, V::mul(a_im, cw_re));
+
+        // f(z) = (2 + 7z - prod) / 4
+        new_zr = V::mul(quarter, V::sub(V::fmadd(seven, zr, two), prod_re));
+        new_zi = V::mul(quarter, V::fmsub(seven, zi, prod_im));
+    }
+
+    // Lanes within COLLATZ_CYCLE_EPS2 of a point of an attracting cycle
+    mask captured(vec zr, vec zi) const
+    {
+        const vec  eps2 = V::set1(COLLATZ_CYCLE_EPS2);
+        const vec  zi2  = V::mul(zi, zi);
+        const mask near_axis = V::cmp_lt(zi2, eps2);
+        mask hit = V::from_bits(0u);
+        if (!V::any(near_axis)) return hit;
+        for (double p : COLLATZ_CYCLE_POINTS) {
+            const vec dr = V::sub(zr, V::set1(p));
+            hit = V::mask_or(hit, V::cmp_lt(V::fmadd(dr, dr, zi2), eps2));
+        }
+        return hit;
+    }
+};
+
+// Vector form of mandelbrot_interior(): main cardioid, then the bulb discs
+template<class V>
+typename V::mask simd_mandelbrot_interior(typename V::vec cr, typename V::vec ci)
+{
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    const vec xq  = V::sub(cr, V::set1(0.25));
+    const vec ci2 = V::mul(ci, ci);
+    const vec q   = V::add(V::mul(xq, xq), ci2);
+    mask in = V::cmp_ge(V::mul(V::set1(0.25), ci2), V::mul(q, V::add(q, xq)));
+    for (const BulbDisc& b : MANDELBROT_BULBS) {
+        const vec dx = V::sub(cr, V::set1(b.cx));
+        const vec dy = V::sub(ci, V::set1(b.cy));
+        const mask d = V::cmp_ge(V::set1(b.r2), V::add(V::mul(dx, dx), V::mul(dy, dy)));
+        in = V::mask_or(in, d);
+    }
+    return in;
+}
+
+// -----------------------------------------------------------------------
+// Streaming row kernel.
+//
+// Computes n consecutive pixels starting at column px; pixel k sits at
+// re = x0 + (px + k) * scale, the same coordinate the scalar path uses.
+// When a lane escapes (or reaches max_iter) its iteration count and |z|^2
+// are written out and the next pixel of the row is loaded into that lane
+// straight away, so one slow lane never holds the others idle. Lanes only
+// go dark once the row has no pixels left to hand out.
+//
+// Interleave = G carries G independent vector groups (G * V::lanes pixels)
+// through the same loop, each with its own active mask. Their mul/add
+// chains do not depend on each other, so the core can overlap them and the
+// loop is bound by FP throughput instead of latency.
+//
+// Smooth colouring is done afterwards in one vectorized pass over the row:
+// smooth = iters + 1 - log_n(log_n|z|), interior pixels get max_iter.
+// With ComputeLyapunov, lyap_out receives the mean log|f'(z)| per pixel.
+//
+// With Periodic, each lane also runs Brent cycle detection: the orbit point
+// is saved at iterations 1, 2, 4, 8, ... and a lane whose orbit returns to
+// within sqrt(per_eps2) of it is retired straight away as interior
+// (per_eps2 = periodicity_eps2(scale), from the _F32 constant for float).
+//
+// Plain Mandelbrot rows (Step::interior_test, not Julia) are first run
+// through simd_mandelbrot_interior(); pixels in the cardioid or a bulb are
+// written out as interior and never handed to a lane.
+//
+// V may be a float wrapper (V::scalar = float): pixel coordinates are still
+// computed in double and rounded once per lane, results are widened to
+// double on the way out.
+// -----------------------------------------------------------------------
+
+// Pixels handled per refill stream; longer spans run as consecutive chunks
+constexpr int STREAM_CHUNK = 256;
+
+// Periodicity compare/snapshot runs on every PERIOD_CHECK_STRIDE-th loop
+// pass only; a settled cycle still lines up with a check within a few
+// periods, and escaping lanes barely pay for the test.
+constexpr int PERIOD_CHECK_STRIDE = 16;
+
+template<class V, int G, bool IsJulia, bool ComputeLyapunov, bool Periodic, class Step>
+void simd_stream_chunk(const Step& f, double x0, double scale, int px, int n,
+                       double im, int max_iter, double c_re, double c_im,
+                       double* out, double* lyap_out)
+{
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    using S    = typename V::scalar;
+    constexpr int L = V::lanes;
+
+    // Lyapunov accumulation threshold, kept inside S's range
+    constexpr double eps_mag2  = std::is_same_v<S, float> ? 1e-30 : 1e-200;
+    constexpr double ln2       = 0.69314718055994531;
+    const double     per_eps2  = periodicity_eps2(
+        scale, std::is_same_v<S, float> ? PERIODICITY_EPS2_F32 : PERIODICITY_EPS2);
+
+    // Per-pixel results of the iteration loop (padded for the smooth pass)
+    S it_buf[STREAM_CHUNK + L];
+    S r2_buf[STREAM_CHUNK + L];
+
+    // Analytic interior pre-test over the whole chunk (Lyapunov colouring
+    // needs every orbit, so it always iterates)
+    constexpr bool PreTest = Step::interior_test && !IsJulia && !ComputeLyapunov;
+    // Attracting-cycle capture, likewise never for Lyapunov colouring
+    constexpr bool CycleTest = Step::cycle_test && !ComputeLyapunov;
+    unsigned char inside[PreTest ? STREAM_CHUNK + L : 1];
+    if constexpr (PreTest) {
+        const vec ci_v = V::set1(im);
+        for (int p = 0; p < n; p += L) {
+            S re_a[L];
+            for (int k = 0; k < L; ++k)
+                re_a[k] = static_cast<S>(x0 + (px + p + k) * scale);
+            const unsigned in = V::bits(simd_mandelbrot_interior<V>(V::load(re_a), ci_v));
+            for (int k = 0; k < L; ++k)
+                inside[p + k] = static_cast<unsigned char>((in >> k) & 1u);
+        }
+    }
+
+    // Advance next past pre-tested interior pixels, writing their results
+    int next = 0;
+    auto skip_inside = [&] {
+        if constexpr (PreTest) {
+            while (next < n && inside[next]) {
+                it_buf[next] = static_cast<S>(max_iter);
+                r2_buf[next] = static_cast<S>(Step::bailout2);
+                ++next;
+            }
+        }
+    };
+
+    // Lane -> pixel bookkeeping (scalar, touched only when a lane finishes)
+    int      lane_px[G][L];
+    S        lane_re[G][L];
+    unsigned live[G];
+    for (int g = 0; g < G; ++g) {
+        live[g] = 0;
+        for (int k = 0; k < L; ++k) {
+            lane_px[g][k] = -1;
+            lane_re[g][k] = static_cast<S>(x0 + px * scale);   // idle lanes: any finite value
+            skip_inside();
+            if (next < n) {
+                lane_px[g][k] = next;
+                lane_re[g][k] = static_cast<S>(x0 + (px + next) * scale);
+                live[g] |= 1u << k;
+                ++next;
+            }
+        }
+    }
+
+    const vec bailout = V::set1(Step::bailout2);
+    const vec one     = V::set1(1.0);
+    const vec zero_v  = V::zero();
+    const vec max_d_v = V::set1(static_cast<double>(max_iter));
+
+    vec  cr[G], ci[G], zr[G], zi[G];
+    mask active[G];
+    // iters_d counts completed iterations of the pixel currently in the lane.
+    // A lane escaping with iters_d == i gives smooth = i + 1 - nu, matching
+    // the scalar formula.
+    vec  iters_d[G];
+    for (int g = 0; g < G; ++g) {
+        const vec re_v = V::load(lane_re[g]);
+        if constexpr (IsJulia) {
+            cr[g] = V::set1(c_re);
+            ci[g] = V::set1(c_im);
+            zr[g] = re_v;
+            zi[g] = V::set1(im);
+        } else {
+            cr[g] = re_v;
+            ci[g] = V::set1(im);
+            zr[g] = V::zero();
+            zi[g] = V::zero();
+        }
+        active[g]  = V::from_bits(live[g]);
+        iters_d[g] = V::zero();
+    }
+
+    // Periodicity: saved orbit point and the iteration of the next snapshot
+    vec per_r[G], per_i[G], per_at[G];
+    const vec per_eps2_v = V::set1(per_eps2);
+    if constexpr (Periodic) {
+        for (int g = 0; g < G; ++g) {
+            per_r[g]  = zr[g];
+            per_i[g]  = zi[g];
+            per_at[g] = one;
+        }
+    }
+
+    // Lyapunov accumulators: log|f'(z)| = log(n) + (n-1)/2 * log(|z|^2), so
+    // the sum needs only the sum of log(|z|^2). That is kept as a running
+    // product of |z|^2, renormalized every iteration by frexp into a
+    // mantissa and an exponent sum; the log is taken once per pixel, when
+    // its lane retires.
+    vec lyap_mant[G], lyap_exp[G], lyap_n_iters[G];
+    if constexpr (ComputeLyapunov) {
+        for (int g = 0; g < G; ++g) {
+            lyap_mant[g]    = one;
+            lyap_exp[g]     = V::zero();
+            lyap_n_iters[g] = V::zero();
+        }
+    }
+
+    // Retire finished lanes of group g, hand them the next pixels of the row
+    auto retire = [&](int g, vec mag2, unsigned esc_bits, unsigned done) {
+        S it_a[L], m2_a[L];
+        V::store(it_a, iters_d[g]);
+        V::store(m2_a, mag2);
+        S lm_a[L], le_a[L], ln_a[L];
+        if constexpr (ComputeLyapunov) {
+            V::store(lm_a, lyap_mant[g]);
+            V::store(le_a, lyap_exp[g]);
+            V::store(ln_a, lyap_n_iters[g]);
+        }
+
+        unsigned refill = 0;
+        for (unsigned b = done; b; b &= b - 1) {
+            const int k = __builtin_ctz(b);
+            const int p = lane_px[g][k];
+            // Only escaped lanes keep their count (maxed and cycling ones are interior)
+            it_buf[p] = ((esc_bits >> k) & 1u) ? it_a[k] : static_cast<S>(max_iter);
+            r2_buf[p] = ((esc_bits >> k) & 1u) ? m2_a[k] : static_cast<S>(Step::bailout2);
+            if constexpr (ComputeLyapunov) {
+                const double sum_log_mag2 = std::log(static_cast<double>(lm_a[k])) +
+                                            static_cast<double>(le_a[k]) * ln2;
+                lyap_out[p] = (ln_a[k] * f.log_n + f.nm1_half * sum_log_mag2) /
+                              std::max<double>(ln_a[k], 1.0);
+            }
+
+            skip_inside();
+            if (next < n) {
+                lane_px[g][k] = next;
+                lane_re[g][k] = static_cast<S>(x0 + (px + next) * scale);
+                refill |= 1u << k;
+                ++next;
+            }
+        }
+
+        live[g]   = (live[g] & ~done) | refill;
+        active[g] = V::from_bits(live[g]);
+
+        const mask done_m = V::from_bits(done);
+        iters_d[g] = V::blend(iters_d[g], zero_v, done_m);
+        if constexpr (ComputeLyapunov) {
+            lyap_mant[g]    = V::blend(lyap_mant[g],    one,    done_m);
+            lyap_exp[g]     = V::blend(lyap_exp[g],     zero_v, done_m);
+            lyap_n_iters[g] = V::blend(lyap_n_iters[g], zero_v, done_m);
+        }
+
+        if (refill) {
+            const mask refill_m = V::from_bits(refill);
+            const vec  new_re   = V::load(lane_re[g]);
+            if constexpr (IsJulia) {
+                zr[g] = V::blend(zr[g], new_re, refill_m);
+                zi[g] = V::blend(zi[g], V::set1(im), refill_m);
+            } else {
+                cr[g] = V::blend(cr[g], new_re, refill_m);
+                zr[g] = V::blend(zr[g], zero_v, refill_m);
+                zi[g] = V::blend(zi[g], zero_v, refill_m);
+            }
+            if constexpr (Periodic) {
+                per_r[g]  = V::blend(per_r[g],  zr[g], refill_m);
+                per_i[g]  = V::blend(per_i[g],  zi[g], refill_m);
+                per_at[g] = V::blend(per_at[g], one,   refill_m);
+            }
+        }
+    };
+
+    auto any_live = [&] {
+        unsigned l = 0;
+        for (int g = 0; g < G; ++g) l |= live[g];
+        return l != 0;
+    };
+
+    int tick = 0;
+    while (any_live()) {
+        unsigned esc_bits[G], done[G];
+        vec      mag2[G];
+
+        for (int g = 0; g < G; ++g) {
+            // A group with no live lane has nothing left to step; at the
+            // tail of a span this is the common case once G > 1
+            done[g] = 0;
+            if (!live[g]) continue;
+
+            const vec zr2 = V::mul(zr[g], zr[g]);
+            const vec zi2 = V::mul(zi[g], zi[g]);
+            mag2[g] = V::add(zr2, zi2);
+
+            // Lyapunov: multiply |z|^2 in for active lanes with mag2 > eps
+            // (the mantissa stays in [0.5, 1), so neither factor range can
+            // over- or underflow the product)
+            if constexpr (ComputeLyapunov) {
+                const mask accum_mask = V::mask_and(active[g],
+                                                    V::cmp_gt(mag2[g], V::set1(eps_mag2)));
+                vec e;
+                lyap_mant[g]    = V::frexp(V::mul(lyap_mant[g], V::blend(one, mag2[g], accum_mask)), e);
+                lyap_exp[g]     = V::add(lyap_exp[g], e);
+                lyap_n_iters[g] = V::add_masked(lyap_n_iters[g], accum_mask, one);
+            }
+
+            // Lanes escaping this iteration; the rest take one more step
+            const mask just_esc = V::mask_and(V::cmp_gt(mag2[g], bailout), active[g]);
+            const mask cont     = V::mask_andnot(just_esc, active[g]);
+
+            // Escaped and idle lanes keep iterating garbage — they are either
+            // reloaded in retire() or masked out of every result.
+            f.step(zr[g], zi[g], zr2, zi2, mag2[g], cr[g], ci[g], zr[g], zi[g]);
+            iters_d[g] = V::add_masked(iters_d[g], cont, one);
+
+            const mask maxed = V::mask_and(V::cmp_ge(iters_d[g], max_d_v), cont);
+            esc_bits[g] = V::bits(just_esc);
+            done[g]     = esc_bits[g] | V::bits(maxed);
+
+            // Lanes caught by an attracting cycle are interior
+            if constexpr (CycleTest)
+                done[g] |= V::bits(V::mask_and(f.captured(zr[g], zi[g]), cont));
+
+        }
+
+        for (int g = 0; g < G; ++g)
+            if (done[g]) retire(g, mag2[g], esc_bits[g], done[g]);
+
+        // Brent: compare with the saved point, then snapshot at powers of two.
+        // Lanes refilled this pass (iters_d == 0) still hold their seed.
+        if constexpr (Periodic) {
+            if (++tick < PERIOD_CHECK_STRIDE) continue;
+            tick = 0;
+            for (int g = 0; g < G; ++g) {
+                if (!live[g]) continue;
+                const mask run  = V::mask_and(active[g], V::cmp_gt(iters_d[g], zero_v));
+                const vec  dr   = V::sub(zr[g], per_r[g]);
+                const vec  di   = V::sub(zi[g], per_i[g]);
+                const vec  d2   = V::add(V::mul(dr, dr), V::mul(di, di));
+                const unsigned cyc = V::bits(V::mask_and(V::cmp_lt(d2, per_eps2_v), run));
+                const mask snap = V::mask_and(V::cmp_ge(iters_d[g], per_at[g]), run);
+                per_r[g]  = V::blend(per_r[g],  zr[g], snap);
+                per_i[g]  = V::blend(per_i[g],  zi[g], snap);
+                per_at[g] = V::blend(per_at[g], V::add(per_at[g], per_at[g]), snap);
+                if (cyc) retire(g, mag2[g], 0u, cyc);
+            }
+        }
+    }
+
+    // Vectorized smooth colouring over the whole chunk using SLEEF
+    for (int p = n; p < n + L; ++p) {
+        it_buf[p] = static_cast<S>(max_iter);
+        r2_buf[p] = static_cast<S>(Step::bailout2);
+    }
+    const vec inv_logn = V::set1(1.0 / f.log_n);
+    const vec half     = V::set1(0.5);
+    for (int p = 0; p < n; p += L) {
+        const vec iters = V::load(it_buf + p);
+        // smooth = iters + 1 - log_n(log_n(|z|))
+        const vec log_zn = V::mul(V::log(V::load(r2_buf + p)), half);    // log(|z|)
+        const vec nu     = V::mul(V::log(V::mul(log_zn, inv_logn)), inv_logn);
+        const vec smooth = V::max(zero_v, V::sub(V::add(iters, one), nu));
+        // Interior points get max_iter; escaped points get smooth value
+        V::store(it_buf + p, V::blend(smooth, max_d_v, V::cmp_ge(iters, max_d_v)));
+    }
+    std::copy(it_buf, it_buf + n, out);
+}
+
+template<class V, int G, bool IsJulia, bool ComputeLyapunov = false,
+         bool Periodic = false, class Step>
+void simd_stream_row(const Step& f, double x0, double scale, int px, int n,
+                     double im, int max_iter, double c_re, double c_im,
+                     double* out, double* lyap_out = nullptr)
+{
+    if (max_iter <= 0) {
+        std::fill(out, out + n, static_cast<double>(max_iter));
+        if constexpr (ComputeLyapunov)
+            std::fill(lyap_out, lyap_out + n, 0.0);
+        return;
+    }
+    for (int done = 0; done < n; done += STREAM_CHUNK) {
+        const int m = std::min(STREAM_CHUNK, n - done);
+        simd_stream_chunk<V, G, IsJulia, ComputeLyapunov, Periodic>(
+            f, x0, scale, px + done, m, im, max_iter, c_re, c_im,
+            out + done, ComputeLyapunov ? lyap_out + done : nullptr);
+    }
+}
+
+// -----------------------------------------------------------------------
+// Lyapunov dispatch — computes both smooth and lambda for a row span.
+// -----------------------------------------------------------------------
+template<class V, int G>
+void simd_lyapunov(FormulaType formula, bool julia_mode,
+                   double x0, double scale, int px, int n, double im,
+                   int max_iter, int exp_i, double exp_f,
+                   double julia_re, double julia_im,
+                   double* smooth, double* lyap)
+{
+    // For MultiSlow: if float exponent is effectively an integer, promote
+    const int slow_int_n = [&]() -> int {
+        if (formula != FormulaType::MultiSlow) return 0;
+        const int n = static_cast<int>(std::round(exp_f));
+        return (n >= 2 && std::abs(exp_f - n) < 1e-9) ? n : 0;
+    }();
+
+    // Runs policy f in Mandelbrot or Julia form
+    auto run = [&](const auto& f) {
+        if (julia_mode)
+            simd_stream_row<V, G, true, true>(f, x0, scale, px, n, im, max_iter,
+                                              julia_re, julia_im, smooth, lyap);
+        else
+            simd_stream_row<V, G, false, true>(f, x0, scale, px, n, im, max_iter,
+                                               0.0, 0.0, smooth, lyap);
+    };
+
+    switch (formula) {
+        case FormulaType::Standard:
+            run(QuadraticStep<V, false, false>());
+            break;
+        case FormulaType::BurningShip:
+            run(QuadraticStep<V, true, false>());
+            break;
+        case FormulaType::Celtic:
+            run(QuadraticStep<V, false, false, true, false>());
+            break;
+        case FormulaType::Buffalo:
+            run(QuadraticStep<V, false, false, true, true>());
+            break;
+        case FormulaType::Mandelbar:
+            if (exp_i == 2) run(QuadraticStep<V, false, true>());
+            else            with_multibrot_step<V, true>(exp_i, run);
+            break;
+        case FormulaType::MultiFast:
+            if (exp_i == 2) run(QuadraticStep<V, false, false>());
+            else            with_multibrot_step<V, false>(exp_i, run);
+            break;
+        case FormulaType::MultiSlow:
+            if (slow_int_n == 2)               run(QuadraticStep<V, false, false>());
+            else if (slow_int_n > 0)           with_multibrot_step<V, false>(slow_int_n, run);
+            else if (multislow_eighths(exp_f)) run(MultibrotDyadicStep<V>(exp_f));
+            else                               run(MultibrotSlowStep<V>(exp_f));
+            break;
+        case FormulaType::Collatz:
+            // Always double: cosh/sinh of pi*Im(z) overflow float before bailout
+            simd_stream_row<SimdTierV, G, true, true>(CollatzStep<SimdTierV>(), x0, scale, px, n, im,
+                                                      max_iter, 0.0, 0.0, smooth, lyap);
+            break;
+        default:
+            run(QuadraticStep<V, false, false>());
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------
+// Double-double kernels for view widths just past double resolution
+// (~1e-13 .. 1e-28): the pixel coordinates and the orbit are carried as
+// DDoubleV, everything else follows simd_stream_chunk() — streaming
+// refill, interleaved groups, Brent periodicity and the vectorized smooth
+// pass. The bailout test and the smooth colouring only need the hi parts.
+//
+// The orbit point for the periodicity compare is differenced in full
+// double-double, against per_eps2 = periodicity_eps2(scale): at these
+// widths an escaping orbit can shadow itself far closer than the double
+// threshold.
+// -----------------------------------------------------------------------
+
+// Degree-2 formulas in double-double, same variants as QuadraticStep
+template<class V, bool IsBurningShip, bool IsMandelbar,
+         bool AbsRe = false, bool AbsIm = false>
+struct QuadraticDdStep {
+    using D = DDoubleV<V>;
+    static constexpr double bailout2 = 4.0;
+    double log_n = std::log(2.0);
+
+    // new_zr / new_zi may alias zr / zi
+    void step(const D& zr, const D& zi, const D& cr, const D& ci, D& new_zr, D& new_zi) const
+    {
+        const D re_raw = D::sub(D::sqr(zr), D::sqr(zi));                // zr^2 - zi^2
+        const D im_raw = IsBurningShip ? D::twice(D::mul(D::abs(zr), D::abs(zi)))
+                                       : D::twice(D::mul(zr, zi));      // 2*zr*zi
+        new_zr = D::add(AbsRe ? D::abs(re_raw) : re_raw, cr);
+        if constexpr (IsMandelbar)
+            new_zi = D::sub(ci, im_raw);
+        else
+            new_zi = D::add(AbsIm ? D::abs(im_raw) : im_raw, ci);
+    }
+};
+
+// Integer-exponent Multibrot / Mandelbar (exp_n >= 3) in double-double
+template<class V, bool IsMandelbar = false>
+struct MultibrotDdStep {
+    using D = DDoubleV<V>;
+    static constexpr double bailout2 = 4.0;
+    int    exp_n;
+    double log_n;
+
+    explicit MultibrotDdStep(int n) : exp_n(n), log_n(std::log(static_cast<double>(n))) {}
+
+    void step(const D& zr, const D& zi, const D& cr, const D& ci, D& new_zr, D& new_zi) const
+    {
+        D pw_r = zr, pw_i = zi;
+        for (int p = 1; p < exp_n; ++p) {
+            const D new_pr = D::sub(D::mul(pw_r, zr), D::mul(pw_i, zi));
+            pw_i = D::add(D::mul(pw_r, zi), D::mul(pw_i, zr));
+            pw_r = new_pr;
+        }
+        new_zr = D::add(pw_r, cr);
+        new_zi = IsMandelbar ? D::sub(ci, pw_i) : D::add(pw_i, ci);
+    }
+};
+
+// Pixel k of the span sits at re = x0 + (px + k) * scale, im = im,
+// x0 and im given as hi + lo pairs
+template<class V, int G, bool IsJulia, bool Periodic, class Step>
+void simd_dd_stream_chunk(const Step& f, DDouble x0, double scale, int px, int n,
+                          DDouble im, int max_iter, double c_re, double c_im,
+                          double per_eps2, double* out)
+{
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    using D    = DDoubleV<V>;
+    constexpr int L = V::lanes;
+
+    double it_buf[STREAM_CHUNK + L];
+    double r2_buf[STREAM_CHUNK + L];
+
+    int      lane_px[G][L];
+    double   lane_rh[G][L], lane_rl[G][L];
+    unsigned live[G];
+    int      next = 0;
+    auto load_lane = [&](int g, int k) {
+        const DDouble re = x0 + (px + next) * scale;
+        lane_px[g][k] = next;
+        lane_rh[g][k] = re.hi;
+        lane_rl[g][k] = re.lo;
+        ++next;
+    };
+    for (int g = 0; g < G; ++g) {
+        live[g] = 0;
+        for (int k = 0; k < L; ++k) {
+            lane_px[g][k] = -1;
+            lane_rh[g][k] = x0.hi;   // idle lanes: any finite value
+            lane_rl[g][k] = 0.0;
+            if (next < n) {
+                load_lane(g, k);
+                live[g] |= 1u << k;
+            }
+        }
+    }
+
+    const vec bailout = V::set1(Step::bailout2);
+    const vec one     = V::set1(1.0);
+    const vec zero_v  = V::zero();
+    const vec max_d_v = V::set1(static_cast<double>(max_iter));
+    const D   im_d    = D::set1(im.hi, im.lo);
+    const D   zero_d  = D::set1(0.0);
+
+    D    cr[G], ci[G], zr[G], zi[G];
+    mask active[G];
+    vec  iters_d[G];
+    for (int g = 0; g < G; ++g) {
+        const D re_d = { V::load(lane_rh[g]), V::load(lane_rl[g]) };
+        if constexpr (IsJulia) {
+            cr[g] = D::set1(c_re);
+            ci[g] = D::set1(c_im);
+            zr[g] = re_d;
+            zi[g] = im_d;
+        } else {
+            cr[g] = re_d;
+            ci[g] = im_d;
+            zr[g] = zero_d;
+            zi[g] = zero_d;
+        }
+        active[g]  = V::from_bits(live[g]);
+        iters_d[g] = V::zero();
+    }
+
+    D   per_r[G], per_i[G];
+    vec per_at[G];
+    const vec per_eps2_v = V::set1(per_eps2);
+    if constexpr (Periodic) {
+        for (int g = 0; g < G; ++g) {
+            per_r[g]  = zr[g];
+            per_i[g]  = zi[g];
+            per_at[g] = one;
+        }
+    }
+
+    auto retire = [&](int g, vec mag2, unsigned esc_bits, unsigned done) {
+        double it_a[L], m2_a[L];
+        V::store(it_a, iters_d[g]);
+        V::store(m2_a, mag2);
+
+        unsigned refill = 0;
+        for (unsigned b = done; b; b &= b - 1) {
+            const int k = __builtin_ctz(b);
+            const int p = lane_px[g][k];
+            it_buf[p] = ((esc_bits >> k) & 1u) ? it_a[k] : static_cast<double>(max_iter);
+            r2_buf[p] = ((esc_bits >> k) & 1u) ? m2_a[k] : Step::bailout2;
+            if (next < n) {
+                load_lane(g, k);
+                refill |= 1u << k;
+            }
+        }
+
+        live[g]   = (live[g] & ~done) | refill;
+        active[g] = V::from_bits(live[g]);
+        iters_d[g] = V::blend(iters_d[g], zero_v, V::from_bits(done));
+
+        if (refill) {
+            const mask refill_m = V::from_bits(refill);
+            const D    new_re   = { V::load(lane_rh[g]), V::load(lane_rl[g]) };
+            if constexpr (IsJulia) {
+                zr[g] = D::blend(zr[g], new_re, refill_m);
+                zi[g] = D::blend(zi[g], im_d,   refill_m);
+            } else {
+                cr[g] = D::blend(cr[g], new_re, refill_m);
+                zr[g] = D::blend(zr[g], zero_d, refill_m);
+                zi[g] = D::blend(zi[g], zero_d, refill_m);
+            }
+            if constexpr (Periodic) {
+                per_r[g]  = D::blend(per_r[g], zr[g], refill_m);
+                per_i[g]  = D::blend(per_i[g], zi[g], refill_m);
+                per_at[g] = V::blend(per_at[g], one,  refill_m);
+            }
+        }
+    };
+
+    auto any_live = [&] {
+        unsigned l = 0;
+        for (int g = 0; g < G; ++g) l |= live[g];
+        return l != 0;
+    };
+
+    int tick = 0;
+    while (any_live()) {
+        unsigned esc_bits[G], done[G];
+        vec      mag2[G];
+
+        for (int g = 0; g < G; ++g) {
+            done[g] = 0;
+            if (!live[g]) continue;
+
+            mag2[g] = V::fmadd(zr[g].hi, zr[g].hi, V::mul(zi[g].hi, zi[g].hi));
+
+            const mask just_esc = V::mask_and(V::cmp_gt(mag2[g], bailout), active[g]);
+            const mask cont     = V::mask_andnot(just_esc, active[g]);
+
+            f.step(zr[g], zi[g], cr[g], ci[g], zr[g], zi[g]);
+            iters_d[g] = V::add_masked(iters_d[g], cont, one);
+
+            const mask maxed = V::mask_and(V::cmp_ge(iters_d[g], max_d_v), cont);
+            esc_bits[g] = V::bits(just_esc);
+            done[g]     = esc_bits[g] | V::bits(maxed);
+        }
+
+        for (int g = 0; g < G; ++g)
+            if (done[g]) retire(g, mag2[g], esc_bits[g], done[g]);
+
+        if constexpr (Periodic) {
+            if (++tick < PERIOD_CHECK_STRIDE) continue;
+            tick = 0;
+            for (int g = 0; g < G; ++g) {
+                if (!live[g]) continue;
+                const mask run = V::mask_and(active[g], V::cmp_gt(iters_d[g], zero_v));
+                const vec  dr  = D::sub(zr[g], per_r[g]).hi;
+                const vec  di  = D::sub(zi[g], per_i[g]).hi;
+                const vec  d2  = V::fmadd(dr, dr, V::mul(di, di));
+                const unsigned cyc = V::bits(V::mask_and(V::cmp_lt(d2, per_eps2_v), run));
+                const mask snap = V::mask_and(V::cmp_ge(iters_d[g], per_at[g]), run);
+                per_r[g]  = D::blend(per_r[g], zr[g], snap);
+                per_i[g]  = D::blend(per_i[g], zi[g], snap);
+                per_at[g] = V::blend(per_at[g], V::add(per_at[g], per_at[g]), snap);
+                if (cyc) retire(g, mag2[g], 0u, cyc);
+            }
+        }
+    }
+
+    for (int p = n; p < n + L; ++p) {
+        it_buf[p] = static_cast<double>(max_iter);
+        r2_buf[p] = Step::bailout2;
+    }
+    const vec inv_logn = V::set1(1.0 / f.log_n);
+    const vec half     = V::set1(0.5);
+    for (int p = 0; p < n; p += L) {
+        const vec iters  = V::load(it_buf + p);
+        const vec log_zn = V::mul(V::log(V::load(r2_buf + p)), half);
+        const vec nu     = V::mul(V::log(V::mul(log_zn, inv_logn)), inv_logn);
+        const vec smooth = V::max(zero_v, V::sub(V::add(iters, one), nu));
+        V::store(it_buf + p, V::blend(smooth, max_d_v, V::cmp_ge(iters, max_d_v)));
+    }
+    std::copy(it_buf, it_buf + n, out);
+}
+
+// Double-double dispatch — formula x julia_mode for a row span. Covers
+// the degree-2 formulas and the integer exponents (exp_n: Mandelbar and
+// Multibrot exponent, already promoted for integer MultiSlow); anything
+// else falls back to plain Mandelbrot.
+template<class V, int G, bool Periodic>
+void simd_double_double(FormulaType formula, bool julia_mode,
+                        DDouble x0, double scale, int px, int n, DDouble im,
+                        int max_iter, int exp_n, double julia_re, double julia_im,
+                        double* out)
+{
+    if (max_iter <= 0) {
+        std::fill(out, out + n, static_cast<double>(max_iter));
+        return;
+    }
+    const double per_eps2 = periodicity_eps2(scale);
+
+    auto run = [&](const auto& f) {
+        for (int done = 0; done < n; done += STREAM_CHUNK) {
+            const int m = std::min(STREAM_CHUNK, n - done);
+            if (julia_mode)
+                simd_dd_stream_chunk<V, G, true, Periodic>(f, x0, scale, px + done, m, im, max_iter,
+                                                           julia_re, julia_im, per_eps2, out + done);
+            else
+                simd_dd_stream_chunk<V, G, false, Periodic>(f, x0, scale, px + done, m, im, max_iter,
+                                                            0.0, 0.0, per_eps2, out + done);
+        }
+    };
+
+    switch (formula) {
+        case FormulaType::BurningShip:
+            run(QuadraticDdStep<V, true, false>());
+            break;
+        case FormulaType::Celtic:
+            run(QuadraticDdStep<V, false, false, true, false>());
+            break;
+        case FormulaType::Buffalo:
+            run(QuadraticDdStep<V, false, false, true, true>());
+            break;
+        case FormulaType::Mandelbar:
+            if (exp_n == 2) run(QuadraticDdStep<V, false, true>());
+            else            run(MultibrotDdStep<V, true>(exp_n));
+            break;
+        case FormulaType::MultiFast:
+        case FormulaType::MultiSlow:
+            if (exp_n == 2) run(QuadraticDdStep<V, false, false>());
+            else            run(MultibrotDdStep<V>(exp_n));
+            break;
+        default:
+            run(QuadraticDdStep<V, false, false>());
+            break;
+    }
+}
+
+} // namespace
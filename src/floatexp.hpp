@@ -0,0 +1,65 @@
+#pragma once
+
+// Extended-exponent float ("floatexp") for deep-zoom deltas past double's
+// exponent range.
+//
+// A double mantissa m with 0.5 <= |m| < 1 (or m = 0) and a separate int
+// exponent: the value is m * 2^e. Past ~1e-300 the pixel offsets dc and
+// the early orbit offsets dz underflow a double, yet they still only need
+// 53 bits of mantissa — just a wider exponent. Every operation
+// renormalizes, so m never over- or underflows.
+//
+// The vector counterpart for the SIMD tiers is FloatExpV in
+// floatexp_simd.hpp.
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+struct FloatExp {
+    static constexpr int ZERO_EXP = INT_MIN / 4;   // exponent of 0: below any other
+    double m = 0.0;
+    int    e = ZERO_EXP;
+
+    FloatExp() = default;
+    explicit FloatExp(double d) : FloatExp(d, 0) {}
+
+    // mant * 2^exp
+    FloatExp(double mant, int exp)
+    {
+        int k;
+        m = std::frexp(mant, &k);
+        e = (m == 0.0) ? ZERO_EXP : exp + k;
+    }
+
+    double to_double() const { return std::ldexp(m, std::max(e, -2000)); }
+
+    FloatExp operator-() const
+    {
+        FloatExp r = *this;
+        r.m = -r.m;
+        return r;
+    }
+
+    friend FloatExp operator*(const FloatExp& a, const FloatExp& b)
+    {
+        return FloatExp(a.m * b.m, a.e + b.e);
+    }
+    friend FloatExp operator*(const FloatExp& a, double b)
+    {
+        return FloatExp(a.m * b, a.e);
+    }
+
+    // The smaller operand is shifted to the larger one's exponent first
+    friend FloatExp operator+(const FloatExp& a, const FloatExp& b)
+    {
+        const FloatExp& big   = (a.e >= b.e) ? a : b;
+        const FloatExp& small = (a.e >= b.e) ? b : a;
+        const int d = small.e - big.e;
+        return FloatExp(big.m + (d < -60 ? 0.0 : std::ldexp(small.m, d)), big.e);
+    }
+    friend FloatExp operator-(const FloatExp& a, const FloatExp& b) { return a + (-b); }
+
+    // Comparisons of magnitude-like (non-negative) values
+    friend bool operator<=(const FloatExp& a, const FloatExp& b) { return (b - a).m >= 0.0; }
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+// FloatExpV — the SIMD counterpart of FloatExp (floatexp.hpp): one double
+// mantissa and one exponent (an integer held as a double) per lane, written
+// against the lane wrappers in simd.hpp (double wrappers only).
+// Include only from the ISA translation units — never from generic code.
+
+#include "simd.hpp"
+#include "floatexp.hpp"
+
+namespace {
+
+template<class V>
+struct FloatExpV {
+    using vec = typename V::vec;
+    vec m;   // 0.5 <= |m| < 1, or 0
+    vec e;   // FloatExp::ZERO_EXP for 0
+
+    // mant * 2^exp, normalized. Mantissas reaching here are normal or zero
+    // (products of normalized values, sums of aligned ones), so everything
+    // below DBL_MIN is taken as 0.
+    static FloatExpV make(vec mant, vec exp)
+    {
+        vec k;
+        const vec  mm   = V::frexp(mant, k);
+        const auto zero = V::cmp_lt(V::abs(mant), V::set1(0x1p-1022));
+        return { V::blend(mm, V::zero(), zero),
+                 V::blend(V::add(exp, k), V::set1(static_cast<double>(FloatExp::ZERO_EXP)), zero) };
+    }
+
+    static FloatExpV from(vec d) { return make(d, V::zero()); }
+
+    vec to_double() const { return V::ldexp(m, e); }
+
+    static FloatExpV mul(const FloatExpV& a, const FloatExpV& b)
+    {
+        return make(V::mul(a.m, b.m), V::add(a.e, b.e));
+    }
+    // a * d for a plain double d
+    static FloatExpV mul(const FloatExpV& a, vec d)
+    {
+        return make(V::mul(a.m, d), a.e);
+    }
+
+    static FloatExpV add(const FloatExpV& a, const FloatExpV& b)
+    {
+        const vec e = V::max(a.e, b.e);
+        return make(V::add(V::ldexp(a.m, V::sub(a.e, e)), V::ldexp(b.m, V::sub(b.e, e))), e);
+    }
+    static FloatExpV sub(const FloatExpV& a, const FloatExpV& b)
+    {
+        return add(a, { V::neg(b.m), b.e });
+    }
+};
+
+} // namespace
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
 
 static const float PANEL_WIDTH   = 280.0f;
 static const float STATUS_HEIGHT = 24.0f;
@@ -28,13 +29,27 @@ int main(int argc, char* argv[])
         return 0;
     }
 
-    // Check for --no-avx flag anywhere in argv
-    bool force_no_avx = false;
+    // Check for --no-avx, --interleave N, --precision auto|double|float,
+    // --orbit-cache DIR|off and --orbit-cache-mb N anywhere in argv
+    bool        force_no_avx = false;
+    int         interleave   = 0;   // 0 = keep the renderer default
+    Precision   precision    = Precision::Auto;
+    std::string orbit_dir;          // empty = the per-user default below
+    int         orbit_mb     = 1024;
     for (int i = 1; i < argc; ++i) {
-        if (std::string(argv[i]) == "--no-avx") {
+        if (std::string(argv[i]) == "--no-avx")
             force_no_avx = true;
-            break;
+        else if (std::string(argv[i]) == "--interleave" && i + 1 < argc)
+            interleave = std::atoi(argv[++i]);
+        else if (std::string(argv[i]) == "--precision" && i + 1 < argc) {
+            const std::string p = argv[++i];
+            if (p == "double")     precision = Precision::Double;
+            else if (p == "float") precision = Precision::Float;
         }
+        else if (std::string(argv[i]) == "--orbit-cache" && i + 1 < argc)
+            orbit_dir = argv[++i];
+        else if (std::string(argv[i]) == "--orbit-cache-mb" && i + 1 < argc)
+            orbit_mb = std::max(1, std::atoi(argv[++i]));
     }
 
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
@@ -70,12 +85,24 @@ int main(int argc, char* argv[])
     // -----------------------------------------------------------------------
     AppState app;
     if (force_no_avx)
-        app.renderer.set_avx(false);
+        app.renderer.set_simd(false);
+    if (interleave > 0)
+        app.renderer.set_interleave(interleave);
+    app.renderer.set_precision(precision);
+    if (orbit_dir.empty()) {
+        if (char* pref = SDL_GetPrefPath("FractalXplorer", "fractal_xplorer")) {
+            orbit_dir = std::string(pref) + "orbits";
+            SDL_free(pref);
+        }
+    }
+    if (orbit_dir != "off")
+        app.renderer.set_orbit_cache(orbit_dir, static_cast<uint64_t>(orbit_mb) << 20);
 
     auto update_title = [&]() {
-        char tbuf[128];
-        std::snprintf(tbuf, sizeof(tbuf), "Fractal Xplorer  —  %s  [zoom: %.2fx]",
-                      fractal_name(app.vs), zoom_display(app.vs));
+        char tbuf[128], zbuf[32];
+        zoom_text(app.vs, zbuf, sizeof(zbuf));
+        std::snprintf(tbuf, sizeof(tbuf), "Fractal Xplorer  —  %s  [zoom: %sx]",
+                      fractal_name(app.vs), zbuf);
         SDL_SetWindowTitle(window, tbuf);
     };
     update_title();
@@ -153,6 +180,22 @@ int main(int argc, char* argv[])
                     reset_view_keep_params(app.vs, app.vs.formula, app.vs.julia_mode);
                     app.dirty = true;
                 }
+                ImGui::Separator();
+                if (ImGui::BeginMenu("Precision")) {
+                    const Precision cur = app.renderer.precision();
+                    const struct { const char* label; Precision p; } items[] = {
+                        {"Auto",   Precision::Auto},
+                        {"Double", Precision::Double},
+                        {"Float",  Precision::Float},
+                    };
+                    for (const auto& it : items) {
+                        if (ImGui::MenuItem(it.label, nullptr, cur == it.p)) {
+                            app.renderer.set_precision(it.p);
+                            app.dirty = true;
+                        }
+                    }
+                    ImGui::EndMenu();
+                }
                 ImGui::EndMenu();
             }
             if (ImGui::BeginMenu("Threads")) {
@@ -201,26 +244,30 @@ int main(int argc, char* argv[])
         if (!io.WantTextInput) {
             if (ImGui::IsKeyPressed(ImGuiKey_Equal) ||
                 ImGui::IsKeyPressed(ImGuiKey_KeypadAdd)) {
-                app.vs.view_width /= 1.5;  app.dirty = true;
+                view_set_width(app.vs, app.vs.view_width / 1.5);
+                app.dirty = true;
             }
             if (ImGui::IsKeyPressed(ImGuiKey_Minus) ||
                 ImGui::IsKeyPressed(ImGuiKey_KeypadSubtract)) {
-                app.vs.view_width *= 1.5;  app.dirty = true;
+                view_set_width(app.vs, app.vs.view_width * 1.5);  app.dirty = true;
             }
             // Arrow keys: pan by 10% of view width
             if (ImGui::IsKeyPressed(ImGuiKey_LeftArrow,  true))
-                { app.vs.center_x -= app.vs.view_width * 0.1;  app.dirty = true; }
+                { view_pan(app.vs, -app.vs.view_width * 0.1, 0.0);  app.dirty = true; }
             if (ImGui::IsKeyPressed(ImGuiKey_RightArrow, true))
-                { app.vs.center_x += app.vs.view_width * 0.1;  app.dirty = true; }
+                { view_pan(app.vs,  app.vs.view_width * 0.1, 0.0);  app.dirty = true; }
             if (ImGui::IsKeyPressed(ImGuiKey_UpArrow,    true))
-                { app.vs.center_y -= app.vs.view_width * 0.1;  app.dirty = true; }
+                { view_pan(app.vs, 0.0, -app.vs.view_width * 0.1);  app.dirty = true; }
             if (ImGui::IsKeyPressed(ImGuiKey_DownArrow,  true))
-                { app.vs.center_y += app.vs.view_width * 0.1;  app.dirty = true; }
-            // PageUp/Down: double or halve iteration count
+                { view_pan(app.vs, 0.0,  app.vs.view_width * 0.1);  app.dirty = true; }
+            // PageUp/Down: double or halve iteration count (never lowered by
+            // PageUp when a deep view left it above the cap)
             if (ImGui::IsKeyPressed(ImGuiKey_PageUp))
-                { app.vs.max_iter = std::min(app.vs.max_iter * 2, 8192);  app.dirty = true; }
+                { app.vs.max_iter = std::max(app.vs.max_iter,
+                                             std::min(app.vs.max_iter * 2, iter_limit(app)));
+                  app.dirty = true; }
             if (ImGui::IsKeyPressed(ImGuiKey_PageDown))
-                { app.vs.max_iter = std::max(app.vs.max_iter / 2, 64);    app.dirty = true; }
+                { app.vs.max_iter = std::max(app.vs.max_iter / 2, ITER_MIN);  app.dirty = true; }
             // P / Shift+P: cycle palette forward / backward
             if (ImGui::IsKeyPressed(ImGuiKey_P)) {
                 int dir = io.KeyShift ? -1 : 1;
@@ -258,18 +305,18 @@ int main(int argc, char* argv[])
 
         const bool render_hovered = ImGui::IsWindowHovered();
 
-        // Mouse wheel zoom (centered on cursor)
+        // Mouse wheel zoom (centered on cursor): the point under the cursor
+        // stays put, so the centre moves by the cursor offset times the
+        // change in scale (panned before the width changes, which may move
+        // its exponent)
         if (render_hovered && io.MouseWheel != 0.0f) {
-            const double mx     = io.MousePos.x - render_x;
-            const double my     = io.MousePos.y - render_y;
+            const double mx     = io.MousePos.x - render_x - irw * 0.5;
+            const double my     = io.MousePos.y - render_y - irh * 0.5;
             const double scale  = app.vs.view_width / irw;
-            const double cur_re = app.vs.center_x + (mx - irw * 0.5) * scale;
-            const double cur_im = app.vs.center_y + (my - irh * 0.5) * scale;
             const double factor = (io.MouseWheel > 0.0f) ? 1.25 : (1.0 / 1.25);
-            app.vs.view_width  /= factor;
-            const double ns     = app.vs.view_width / irw;
-            app.vs.center_x = cur_re - (mx - irw * 0.5) * ns;
-            app.vs.center_y = cur_im - (my - irh * 0.5) * ns;
+            const double ns     = scale / factor;
+            view_pan(app.vs, mx * (scale - ns), my * (scale - ns));
+            view_set_width(app.vs, app.vs.view_width / factor);
             app.dirty = true;
         }
 
@@ -277,7 +324,7 @@ int main(int argc, char* argv[])
         // Orbit is not available in Newton mode
         if (app.show_orbit && app.vs.mode != FractalMode::Newton && render_hovered &&
             ImGui::IsMouseClicked(ImGuiMouseButton_Left) && io.KeyCtrl) {
-            const double scale = app.vs.view_width / irw;
+            const double scale = true_view_width(app.vs) / irw;
             app.orbit_re     = app.vs.center_x + (io.MousePos.x - render_x - irw * 0.5) * scale;
             app.orbit_im     = app.vs.center_y + (io.MousePos.y - render_y - irh * 0.5) * scale;
             app.orbit_active = true;
@@ -293,11 +340,14 @@ int main(int argc, char* argv[])
         if (app.panning) {
             if (ImGui::IsMouseDown(ImGuiMouseButton_Left)) {
                 const double scale = app.pan_start_vs.view_width / irw;
-                app.vs.center_x   = app.pan_start_vs.center_x
-                                     - (io.MousePos.x - app.pan_start_mouse.x) * scale;
-                app.vs.center_y   = app.pan_start_vs.center_y
-                                     - (io.MousePos.y - app.pan_start_mouse.y) * scale;
-                app.vs.view_width = app.pan_start_vs.view_width;
+                app.vs.center_x    = app.pan_start_vs.center_x;
+                app.vs.center_y    = app.pan_start_vs.center_y;
+                app.vs.center_x_lo = app.pan_start_vs.center_x_lo;
+                app.vs.center_y_lo = app.pan_start_vs.center_y_lo;
+                app.vs.view_width  = app.pan_start_vs.view_width;
+                app.vs.view_exp    = app.pan_start_vs.view_exp;
+                view_pan(app.vs, -(io.MousePos.x - app.pan_start_mouse.x) * scale,
+                                 -(io.MousePos.y - app.pan_start_mouse.y) * scale);
                 app.dirty = true;
             } else {
                 app.panning = false;
@@ -327,9 +377,9 @@ int main(int argc, char* argv[])
                 const float bh = y1 - y0;
                 if (bw > 4.0f && bh > 4.0f) {
                     const double scale = app.vs.view_width / irw;
-                    app.vs.center_x   = app.vs.center_x + (x0 + bw * 0.5f - irw * 0.5) * scale;
-                    app.vs.center_y   = app.vs.center_y + (y0 + bh * 0.5f - irh * 0.5) * scale;
-                    app.vs.view_width = bw * scale;
+                    view_pan(app.vs, (x0 + bw * 0.5f - irw * 0.5) * scale,
+                                     (y0 + bh * 0.5f - irh * 0.5) * scale);
+                    view_set_width(app.vs, bw * scale);
                     app.dirty = true;
                 }
                 app.zoom_boxing = false;
@@ -337,9 +387,10 @@ int main(int argc, char* argv[])
         }
 
         // Orbit overlay (not available in Newton mode)
-        if (app.show_orbit && app.orbit_active && app.vs.mode != FractalMode::Newton) {
+        if (app.show_orbit && app.orbit_active && app.vs.mode != FractalMode::Newton &&
+            true_view_width(app.vs) / irw > 0.0) {
             auto pts = compute_orbit(app.orbit_re, app.orbit_im, app.vs, 20);
-            const double scale = app.vs.view_width / irw;
+            const double scale = true_view_width(app.vs) / irw;
             auto to_screen = [&](double r, double i) -> ImVec2 {
                 return { render_x + static_cast<float>((r - app.vs.center_x) / scale + irw * 0.5f),
                          render_y + static_cast<float>((i - app.vs.center_y) / scale + irh * 0.5f) };
@@ -367,10 +418,30 @@ int main(int argc, char* argv[])
             ImGuiWindowFlags_NoBringToFrontOnFocus |
             ImGuiWindowFlags_NoScrollbar);
         ImGui::PopStyleVar();
-        ImGui::Text("x: %.8f   y: %.8f   zoom: %.4fx   iter: %d   %.0f ms  [%s  %dt]",
-                    app.vs.center_x, app.vs.center_y, zoom_display(app.vs), app.vs.max_iter,
+        // Deep zoom: iterations per pixel the series approximation skipped,
+        // whether the reference orbit came from the orbit cache, and glitched
+        // pixels fixed / found with the extra references used, plus those the
+        // final pass only approximated
+        char deep_tag[128], glitch_tag[64], approx_tag[24], zoom_str[32];
+        glitch_tag[0] = approx_tag[0] = '\0';
+        if (app.renderer.approximated_pixels > 0)
+            std::snprintf(approx_tag, sizeof(approx_tag), ", %d approx",
+                          app.renderer.approximated_pixels);
+        if (app.renderer.glitched_pixels > 0)
+            std::snprintf(glitch_tag, sizeof(glitch_tag), ", glitches %d/%d%s (%d refs)",
+                          app.renderer.corrected_pixels, app.renderer.glitched_pixels,
+                          approx_tag, app.renderer.glitch_references);
+        std::snprintf(deep_tag, sizeof(deep_tag), " perturb%s, skip %d%s%s",
+                      app.vs.view_exp ? " floatexp" : "", app.renderer.series_skip,
+                      app.renderer.orbit_cached ? ", cached orbit" : "", glitch_tag);
+        zoom_text(app.vs, zoom_str, sizeof(zoom_str));
+        ImGui::Text("x: %.8f   y: %.8f   zoom: %sx   iter: %d   %.0f ms  [%s%s  %dt]",
+                    app.vs.center_x, app.vs.center_y, zoom_str, app.vs.max_iter,
                     app.main_render_ms,
-                    app.renderer.avx_active ? "AVX" : "scalar",
+                    app.renderer.path_name(),
+                    app.renderer.deep_active ? deep_tag
+                        : app.renderer.dd_active  ? " dd"
+                        : app.renderer.f32_active ? " f32" : "",
                     app.renderer.thread_count);
         ImGui::End();
 
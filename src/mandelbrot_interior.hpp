@@ -0,0 +1,39 @@
+#pragma once
+
+// Analytic interior tests for the plain Mandelbrot set (z^2 + c, not Julia).
+// Points inside the main cardioid or one of the discs below never escape, so
+// the kernels mark them interior without iterating. Shared by the scalar
+// kernel and the SIMD stream kernel.
+//
+// The period-2 disc is exact. The secondary-bulb discs sit around each
+// bulb's nucleus and are a little smaller than the bulb itself; every point
+// on their boundary was checked numerically to settle into the bulb's cycle.
+
+struct BulbDisc {
+    double cx, cy;   // centre (the bulb's nucleus)
+    double r2;       // radius squared
+};
+
+constexpr BulbDisc MANDELBROT_BULBS[] = {
+    {-1.0,                0.0,               0.0625  },  // period 2, radius 1/4
+    {-0.122561166876654,  0.744861766619744, 0.0081  },  // period 3 (upper), r = 0.09
+    {-0.122561166876654, -0.744861766619744, 0.0081  },  // period 3 (lower), r = 0.09
+    {-1.310702641336833,  0.0,               0.003025},  // period 4, r = 0.055
+};
+
+inline bool mandelbrot_interior(double cr, double ci)
+{
+    // Main cardioid: q * (q + (x - 1/4)) <= y^2 / 4, q = (x - 1/4)^2 + y^2
+    const double xq  = cr - 0.25;
+    const double ci2 = ci * ci;
+    const double q   = xq * xq + ci2;
+    if (q * (q + xq) <= 0.25 * ci2)
+        return true;
+
+    for (const BulbDisc& b : MANDELBROT_BULBS) {
+        const double dx = cr - b.cx, dy = ci - b.cy;
+        if (dx * dx + dy * dy <= b.r2)
+            return true;
+    }
+    return false;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include "view_state.hpp"
 
@@ -29,25 +30,188 @@ inline void horner_eval(double zr, double zi, int degree,
     }
 }
 
-// Newton iteration for a single pixel.
+// Same pass carrying p, p', and the Taylor coefficients t2 = p''/2 and
+// t3 = p'''/6 for the higher-order methods (the factorials cancel out of
+// their step formulas)
+inline void horner_eval_taylor(double zr, double zi, int degree,
+                               const double* coeffs_re, const double* coeffs_im,
+                               double& pr, double& pi, double& dr, double& di,
+                               double& t2r, double& t2i, double& t3r, double& t3i)
+{
+    pr  = 1.0; pi  = 0.0;
+    dr  = 0.0; di  = 0.0;
+    t2r = 0.0; t2i = 0.0;
+    t3r = 0.0; t3i = 0.0;
+
+    for (int k = degree - 1; k >= 0; --k) {
+        // Highest first: each accumulator takes the previous value of the next lower one
+        const double n3r = t3r * zr - t3i * zi + t2r;
+        const double n3i = t3r * zi + t3i * zr + t2i;
+        t3r = n3r; t3i = n3i;
+
+        const double n2r = t2r * zr - t2i * zi + dr;
+        const double n2i = t2r * zi + t2i * zr + di;
+        t2r = n2r; t2i = n2i;
+
+        const double ndr = dr * zr - di * zi + pr;
+        const double ndi = dr * zi + di * zr + pi;
+        dr = ndr; di = ndi;
+
+        const double npr = pr * zr - pi * zi + coeffs_re[k];
+        const double npi = pr * zi + pi * zr + coeffs_im[k];
+        pr = npr; pi = npi;
+    }
+}
+
+// Step of vs.newton_method in product form, for degrees past
+// NEWTON_HORNER_DEGREE. With S_j = sum_k 1/(z - r_k)^j over the roots
+// (S1 = p'/p, S2 = S1^2 - p''/p, S3 = S1^3 - (3/2) S1 p''/p + p'''/(2p)):
+//   Newton:      N = 1,                 D = S1
+//   Halley:      N = 2 S1,              D = S1^2 + S2
+//   Householder: N = 3 (S1^2 + S2),     D = S1 (S1^2 + 3 S2) + 2 S3
+// z on a root gives a zero step. Returns false when |D|^2 is degenerate.
+inline bool newton_step_roots(double zr, double zi, const ViewState& vs,
+                              double& step_re, double& step_im)
+{
+    double s1r = 0.0, s1i = 0.0, s2r = 0.0, s2i = 0.0, s3r = 0.0, s3i = 0.0;
+    for (int k = 0; k < vs.newton_degree; ++k) {
+        const double wr = zr - vs.newton_roots_re[k];
+        const double wi = zi - vs.newton_roots_im[k];
+        const double m  = wr * wr + wi * wi;
+        if (m == 0.0) { step_re = step_im = 0.0; return true; }
+        const double ur =  wr / m;              // 1 / w
+        const double ui = -wi / m;
+        s1r += ur; s1i += ui;
+        const double u2r = ur * ur - ui * ui;   // 1 / w^2
+        const double u2i = 2.0 * ur * ui;
+        s2r += u2r; s2i += u2i;
+        s3r += u2r * ur - u2i * ui;             // 1 / w^3
+        s3i += u2r * ui + u2i * ur;
+    }
+
+    double nr, ni, dr, di;
+    if (vs.newton_method == NewtonMethod::Newton) {
+        nr = 1.0; ni = 0.0;
+        dr = s1r; di = s1i;
+    } else {
+        const double qr = s1r * s1r - s1i * s1i;   // S1^2
+        const double qi = 2.0 * s1r * s1i;
+        if (vs.newton_method == NewtonMethod::Halley) {
+            nr = 2.0 * s1r; ni = 2.0 * s1i;
+            dr = qr + s2r;  di = qi + s2i;
+        } else {
+            nr = 3.0 * (qr + s2r); ni = 3.0 * (qi + s2i);
+            const double vr = qr + 3.0 * s2r, vi = qi + 3.0 * s2i;
+            dr = s1r * vr - s1i * vi + 2.0 * s3r;
+            di = s1r * vi + s1i * vr + 2.0 * s3i;
+        }
+    }
+
+    const double denom = dr * dr + di * di;
+    if (denom < 1e-30) return false;  // degenerate derivative
+    step_re = (nr * dr + ni * di) / denom;
+    step_im = (ni * dr - nr * di) / denom;
+    return true;
+}
+
+// Step of vs.newton_method at z, as N / D:
+//   Newton:      N = p,                 D = p'
+//   Halley:      N = p p',              D = u,    u = p'^2 - p t2
+//   Householder: N = p u,               D = p'(u - p t2) + p^2 t3
+// (the textbook forms with p'' = 2 t2 and p''' = 6 t3, common factors
+// cancelled). Returns false when |D|^2 is degenerate.
+inline bool newton_step(double zr, double zi, const ViewState& vs,
+                        double& step_re, double& step_im)
+{
+    if (vs.newton_degree > NEWTON_HORNER_DEGREE)
+        return newton_step_roots(zr, zi, vs, step_re, step_im);
+
+    const double* c_re = vs.newton_coeffs_re.data();
+    const double* c_im = vs.newton_coeffs_im.data();
+    double nr, ni, dr, di;
+    if (vs.newton_method == NewtonMethod::Newton) {
+        horner_eval(zr, zi, vs.newton_degree, c_re, c_im, nr, ni, dr, di);
+    } else {
+        double pr, pi, p1r, p1i, t2r, t2i, t3r, t3i;
+        horner_eval_taylor(zr, zi, vs.newton_degree, c_re, c_im,
+                           pr, pi, p1r, p1i, t2r, t2i, t3r, t3i);
+        const double qr = pr * t2r - pi * t2i;          // p t2
+        const double qi = pr * t2i + pi * t2r;
+        const double ur = p1r * p1r - p1i * p1i - qr;   // p'^2 - p t2
+        const double ui = 2.0 * p1r * p1i - qi;
+        if (vs.newton_method == NewtonMethod::Halley) {
+            nr = pr * p1r - pi * p1i;
+            ni = pr * p1i + pi * p1r;
+            dr = ur; di = ui;
+        } else {
+            nr = pr * ur - pi * ui;
+            ni = pr * ui + pi * ur;
+            const double vr = ur - qr, vi = ui - qi;     // p'^2 - 2 p t2
+            const double sr = pr * pr - pi * pi;         // p^2
+            const double si = 2.0 * pr * pi;
+            dr = p1r * vr - p1i * vi + (sr * t3r - si * t3i);
+            di = p1r * vi + p1i * vr + (sr * t3i + si * t3r);
+        }
+    }
+
+    // Complex division: N / D
+    const double denom = dr * dr + di * di;
+    if (denom < 1e-30) return false;  // degenerate derivative
+    step_re = (nr * dr + ni * di) / denom;
+    step_im = (ni * dr - nr * di) / denom;
+    return true;
+}
+
+// Index of the root nearest z, and its squared distance in d2
+inline int newton_nearest_root(double zr, double zi, const ViewState& vs, double& d2)
+{
+    int best = 0;
+    d2 = 1e30;
+    for (int r = 0; r < vs.newton_degree; ++r) {
+        const double dx = zr - vs.newton_roots_re[r];
+        const double dy = zi - vs.newton_roots_im[r];
+        const double e2 = dx * dx + dy * dy;
+        if (e2 < d2) { d2 = e2; best = r; }
+    }
+    return best;
+}
+
+// Fractional iteration for a pixel caught by the root trap at squared
+// distance d2. Treating q = d2 / (4 trap_r2) as raised to the method's
+// order every iteration, log_order(log q / log(1/4)) counts the iterations
+// since q passed 1/4 — 0 on the trap's edge — so the count stays continuous
+// across the trap boundary.
+inline double newton_trap_frac(double d2, double trap_r2, int order)
+{
+    const double q = std::log(0.25 * d2 / trap_r2) / std::log(0.25);
+    return 1.0 - std::min(1.0, std::log(q) / std::log(static_cast<double>(order)));
+}
+
+// Newton-mode iteration (vs.newton_method) for a single pixel.
 // Returns which root the pixel converged to and smooth iteration count.
 // When compute_smooth=false, returns integer iteration count (no log).
+// With vs.newton_root_trap the pixel also stops as soon as z is within the
+// trap radius of a root.
 template <bool ComputeSmooth = true>
 inline NewtonResult newton_iter(double re, double im, const ViewState& vs)
 {
-    const int degree = vs.newton_degree;
     double zr = re, zi = im;
 
     for (int i = 0; i < vs.max_iter; ++i) {
-        double pr, pi, dr, di;
-        horner_eval(zr, zi, degree, vs.newton_coeffs_re, vs.newton_coeffs_im, pr, pi, dr, di);
-
-        // Complex division: f(z) / f'(z)
-        const double denom = dr * dr + di * di;
-        if (denom < 1e-30) break;  // degenerate derivative
+        if (vs.newton_root_trap) {
+            double d2;
+            const int r = newton_nearest_root(zr, zi, vs, d2);
+            if (d2 < vs.newton_trap_r2) {
+                if constexpr (ComputeSmooth)
+                    return {r, i + newton_trap_frac(d2, vs.newton_trap_r2,
+                                                    newton_method_order(vs.newton_method))};
+                else
+                    return {r, static_cast<double>(i)};
+            }
+        }
 
-        const double step_re = (pr * dr + pi * di) / denom;
-        const double step_im = (pi * dr - pr * di) / denom;
+        double step_re, step_im;
+        if (!newton_step(zr, zi, vs, step_re, step_im)) break;
 
         zr -= step_re;
         zi -= step_im;
@@ -55,15 +219,8 @@ inline NewtonResult newton_iter(double re, double im, const ViewState& vs)
         // Check convergence
         const double step_mag2 = step_re * step_re + step_im * step_im;
         if (step_mag2 < 1e-20) {
-            // Find nearest root
-            int best = 0;
-            double best_dist = 1e30;
-            for (int r = 0; r < degree; ++r) {
-                const double dx = zr - vs.newton_roots_re[r];
-                const double dy = zi - vs.newton_roots_im[r];
-                const double d2 = dx * dx + dy * dy;
-                if (d2 < best_dist) { best_dist = d2; best = r; }
-            }
+            double d2;
+            const int best = newton_nearest_root(zr, zi, vs, d2);
             if constexpr (ComputeSmooth) {
                 const double frac = std::log(1e-20) / std::log(step_mag2);
                 return {best, static_cast<double>(i) + frac};
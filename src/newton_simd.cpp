@@ -0,0 +1,413 @@
+// Newton fractal SIMD kernel — one row span per call, V::lanes pixels at a
+// time, the tail group with its surplus lanes masked off.
+// Compiled once per ISA tier with -DSIMD_TIER=<tier> (see add_kernel_tier in
+// CMakeLists.txt); do NOT include from other translation units.
+// No SLEEF needed — only basic arithmetic (mul, add, sub, div).
+// ComputeSmooth=false skips step_mag2 tracking and log() for flat coloring.
+// V is SimdTierV (double) or SimdTierVF (float, twice the lanes).
+// Degree is a template parameter: the Horner loop is fully unrolled and the
+// coefficients are broadcast into registers once per span (one kernel per
+// degree 2..NEWTON_HORNER_DEGREE in each table). Degree=0 is the product-form
+// kernel for any higher degree: it sums 1/(z - r_k)^j over the roots
+// instead (newton_step_roots() in newton.hpp).
+// Trap=true also retires a lane as soon as z comes within the root trap
+// radius (ViewState::newton_trap_r2) of any root.
+// M picks the iteration (see NewtonMethod and newton_step() in newton.hpp):
+// Halley and Householder carry the Taylor coefficients t2 = p''/2 and
+// t3 = p'''/6 through the same unrolled Horner pass.
+
+#include "simd_dispatch.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#ifndef SIMD_TIER
+#error "newton_simd.cpp must be built with -DSIMD_TIER=<tier>"
+#endif
+
+#define SIMD_CAT_(a, b) a##b
+#define SIMD_CAT(a, b)  SIMD_CAT_(a, b)
+
+namespace {
+
+// Convergence threshold on |step|^2. Float cannot resolve 1e-20, so it stops
+// one quadratic step earlier at 1e-10 and adds that step back in the smooth
+// value — log(thresh)/log(step_mag2) is unchanged by squaring both.
+template <class S> constexpr double newton_conv_thresh = 1e-20;
+template <>        constexpr double newton_conv_thresh<float> = 1e-10;
+
+// Fractional part for a pixel caught by the root trap at squared distance
+// d2 — same as newton_trap_frac() in newton.hpp
+double trap_frac(double d2, double trap_r2, int order)
+{
+    const double q = std::log(0.25 * d2 / trap_r2) / std::log(0.25);
+    return 1.0 - std::min(1.0, std::log(q) / std::log(static_cast<double>(order)));
+}
+
+// Step numerator N and denominator D at z from the expanded coefficients
+// (newton_step() in newton.hpp), Degree unrolled Horner steps
+template <class V, NewtonMethod M, int Degree>
+inline void horner_step(typename V::vec zr, typename V::vec zi,
+                        const typename V::vec* c_re, const typename V::vec* c_im,
+                        typename V::vec& nr, typename V::vec& ni,
+                        typename V::vec& dr, typename V::vec& di)
+{
+    using vec = typename V::vec;
+
+    // Horner evaluation of p(z) and p'(z) (and t2, t3 for the higher
+    // orders). The first step from p = 1, d = t2 = t3 = 0 (leading
+    // coefficient is implicit 1) is taken directly: d = 1, p = z + coeffs[degree-1].
+    vec pr = V::add(zr, c_re[Degree - 1]), pi = V::add(zi, c_im[Degree - 1]);
+    dr = V::set1(1.0);
+    di = V::zero();
+    vec t2r = V::zero(), t2i = V::zero(), t3r = V::zero(), t3i = V::zero();
+
+#pragma GCC unroll 8
+    for (int k = Degree - 2; k >= 0; --k) {
+        // Highest first: each accumulator takes the previous value of the next lower one
+        if constexpr (M == NewtonMethod::Householder) {
+            const vec n3r = V::add(V::fmsub(t3r, zr, V::mul(t3i, zi)), t2r);
+            const vec n3i = V::add(V::fmadd(t3r, zi, V::mul(t3i, zr)), t2i);
+            t3r = n3r; t3i = n3i;
+        }
+        if constexpr (M != NewtonMethod::Newton) {
+            const vec n2r = V::add(V::fmsub(t2r, zr, V::mul(t2i, zi)), dr);
+            const vec n2i = V::add(V::fmadd(t2r, zi, V::mul(t2i, zr)), di);
+            t2r = n2r; t2i = n2i;
+        }
+
+        // d = d * z + p
+        const vec ndr = V::add(V::fmsub(dr, zr, V::mul(di, zi)), pr);
+        const vec ndi = V::add(V::fmadd(dr, zi, V::mul(di, zr)), pi);
+        dr = ndr; di = ndi;
+
+        // p = p * z + coeffs[k]
+        const vec npr = V::add(V::fmsub(pr, zr, V::mul(pi, zi)), c_re[k]);
+        const vec npi = V::add(V::fmadd(pr, zi, V::mul(pi, zr)), c_im[k]);
+        pr = npr; pi = npi;
+    }
+
+    nr = pr;
+    ni = pi;
+    if constexpr (M != NewtonMethod::Newton) {
+        const vec qr = V::fmsub(pr, t2r, V::mul(pi, t2i));           // p t2
+        const vec qi = V::fmadd(pr, t2i, V::mul(pi, t2r));
+        const vec ur = V::sub(V::fmsub(dr, dr, V::mul(di, di)), qr);  // p'^2 - p t2
+        const vec ui = V::sub(V::mul(V::add(dr, dr), di), qi);
+        if constexpr (M == NewtonMethod::Halley) {
+            nr = V::fmsub(pr, dr, V::mul(pi, di));
+            ni = V::fmadd(pr, di, V::mul(pi, dr));
+            dr = ur; di = ui;
+        } else {
+            nr = V::fmsub(pr, ur, V::mul(pi, ui));
+            ni = V::fmadd(pr, ui, V::mul(pi, ur));
+            const vec vr = V::sub(ur, qr), vi = V::sub(ui, qi);       // p'^2 - 2 p t2
+            const vec sr = V::fmsub(pr, pr, V::mul(pi, pi));          // p^2
+            const vec si = V::mul(V::add(pr, pr), pi);
+            const vec er = V::fmsub(sr, t3r, V::mul(si, t3i));        // p^2 t3
+            const vec ei = V::fmadd(sr, t3i, V::mul(si, t3r));
+            const vec new_dr = V::add(V::fmsub(dr, vr, V::mul(di, vi)), er);
+            di = V::add(V::fmadd(dr, vi, V::mul(di, vr)), ei);
+            dr = new_dr;
+        }
+    }
+}
+
+// Lanes within this |z - r|^2 of a root count as on it (zero step, as
+// newton_step_roots() does for an exact hit); also keeps S1^3 finite
+template <class S> constexpr double newton_min_dist2 = 1e-150;
+template <>        constexpr double newton_min_dist2<float> = 1e-20;
+
+// N and D from the sums S_j = sum_k 1/(z - r_k)^j over the roots
+// (newton_step_roots() in newton.hpp), plus each lane's squared distance
+// to its nearest root for the trap test
+template <class V, NewtonMethod M>
+inline void product_step(typename V::vec zr, typename V::vec zi,
+                         const double* roots_re, const double* roots_im, int degree,
+                         typename V::vec& nr, typename V::vec& ni,
+                         typename V::vec& dr, typename V::vec& di,
+                         typename V::vec& near_d2)
+{
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    const vec min_d2 = V::set1(newton_min_dist2<typename V::scalar>);
+    const vec one    = V::set1(1.0);
+
+    vec s1r = V::zero(), s1i = V::zero();
+    vec s2r = V::zero(), s2i = V::zero();
+    vec s3r = V::zero(), s3i = V::zero();
+    near_d2 = V::set1(1e30);
+    for (int k = 0; k < degree; ++k) {
+        const vec wr = V::sub(zr, V::set1(roots_re[k]));
+        const vec wi = V::sub(zi, V::set1(roots_im[k]));
+        const vec m  = V::fmadd(wr, wr, V::mul(wi, wi));
+        near_d2 = V::min(near_d2, m);
+        const vec inv = V::div(one, V::max(m, min_d2));
+        const vec ur  = V::mul(wr, inv);                             // 1 / w
+        const vec ui  = V::neg(V::mul(wi, inv));
+        s1r = V::add(s1r, ur);
+        s1i = V::add(s1i, ui);
+        if constexpr (M != NewtonMethod::Newton) {
+            const vec u2r = V::fmsub(ur, ur, V::mul(ui, ui));        // 1 / w^2
+            const vec u2i = V::mul(V::add(ur, ur), ui);
+            s2r = V::add(s2r, u2r);
+            s2i = V::add(s2i, u2i);
+            if constexpr (M == NewtonMethod::Householder) {
+                s3r = V::add(s3r, V::fmsub(u2r, ur, V::mul(u2i, ui))); // 1 / w^3
+                s3i = V::add(s3i, V::fmadd(u2r, ui, V::mul(u2i, ur)));
+            }
+        }
+    }
+
+    const mask on_root = V::cmp_lt(near_d2, min_d2);
+    if constexpr (M == NewtonMethod::Newton) {
+        nr = one;  ni = V::zero();
+        dr = s1r;  di = s1i;
+    } else {
+        const vec qr = V::fmsub(s1r, s1r, V::mul(s1i, s1i));        // S1^2
+        const vec qi = V::mul(V::add(s1r, s1r), s1i);
+        if constexpr (M == NewtonMethod::Halley) {
+            nr = V::add(s1r, s1r);   ni = V::add(s1i, s1i);
+            dr = V::add(qr, s2r);    di = V::add(qi, s2i);
+        } else {
+            const vec three = V::set1(3.0);
+            nr = V::mul(three, V::add(qr, s2r));
+            ni = V::mul(three, V::add(qi, s2i));
+            const vec vr = V::fmadd(three, s2r, qr), vi = V::fmadd(three, s2i, qi);
+            dr = V::add(V::fmsub(s1r, vr, V::mul(s1i, vi)), V::add(s3r, s3r));
+            di = V::add(V::fmadd(s1r, vi, V::mul(s1i, vr)), V::add(s3i, s3i));
+        }
+    }
+    nr = V::blend(nr, V::zero(), on_root);
+    ni = V::blend(ni, V::zero(), on_root);
+    dr = V::blend(dr, one, on_root);
+    di = V::blend(di, V::zero(), on_root);
+}
+
+template <class V, NewtonMethod M, bool ComputeSmooth, bool Trap, int Degree>
+void simd_newton_impl(double x0, double scale, int px, int n, double im,
+                      int max_iter, int degree,
+                      const double* coeffs_re, const double* coeffs_im,
+                      const double* roots_re, const double* roots_im,
+                      double trap_r2, int* root_out, double* smooth_out)
+{
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    using S    = typename V::scalar;
+    constexpr int    L      = V::lanes;
+    constexpr double thresh = newton_conv_thresh<S>;
+    constexpr double late   = std::is_same_v<S, float> ? 1.0 : 0.0;  // skipped step
+
+    const vec one          = V::set1(1.0);
+    const vec conv_thresh  = V::set1(thresh);
+    const vec degen_thresh = V::set1(1e-30);
+
+    // Degree > 0: coefficients and roots broadcast once; the product form
+    // reads its roots from memory each pass (any count)
+    const int nroots = Degree > 0 ? Degree : degree;
+    constexpr int NB = Degree > 0 ? Degree : 1;
+    vec c_re[NB], c_im[NB], r_re[NB], r_im[NB];
+    for (int k = 0; k < Degree; ++k) {
+        c_re[k] = V::set1(coeffs_re[k]);
+        c_im[k] = V::set1(coeffs_im[k]);
+        r_re[k] = V::set1(roots_re[k]);
+        r_im[k] = V::set1(roots_im[k]);
+    }
+
+    // Squared distance to the nearest root (and its index) for every lane
+    auto nearest_root = [&](vec zr, vec zi, vec& best_d2, vec& best_idx) {
+        best_d2  = V::set1(1e30);
+        best_idx = V::zero();
+        for (int k = 0; k < nroots; ++k) {
+            vec dx, dy;
+            if constexpr (Degree > 0) {
+                dx = V::sub(zr, r_re[k]);
+                dy = V::sub(zi, r_im[k]);
+            } else {
+                dx = V::sub(zr, V::set1(roots_re[k]));
+                dy = V::sub(zi, V::set1(roots_im[k]));
+            }
+            const vec  d2    = V::fmadd(dx, dx, V::mul(dy, dy));
+            const mask close = V::cmp_lt(d2, best_d2);
+            best_d2  = V::blend(best_d2, d2, close);
+            best_idx = V::blend(best_idx, V::set1(k), close);
+        }
+    };
+
+    const vec trap = V::set1(trap_r2);
+
+    // L pixels per group; lanes past the span's end start inactive, so the
+    // tail group costs no extra iterations and its surplus is discarded
+    for (int g = 0; g < n; g += L) {
+        const int m = std::min(L, n - g);
+        S re_a[L];
+        for (int k = 0; k < L; ++k)
+            re_a[k] = static_cast<S>(x0 + (px + g + std::min(k, m - 1)) * scale);
+        vec zr = V::load(re_a);
+        vec zi = V::set1(im);
+
+        vec  iters_d = V::zero();
+        vec  frozen_step_mag2;
+        if constexpr (ComputeSmooth)
+            frozen_step_mag2 = V::set1(1.0); // step_mag2 at convergence
+        mask active = V::from_bits((1u << m) - 1);
+
+        // Trapped lanes: -1 until caught, then the squared distance at that point
+        vec trapped_d2 = V::set1(-1.0);
+
+        for (int i = 0; i < max_iter; ++i) {
+            // Step numerator N and denominator D; the product form finds each
+            // lane's nearest root distance in the same pass
+            vec nr, ni, dr, di, near_d2;
+            if constexpr (Degree > 0) {
+                if constexpr (Trap) {
+                    vec idx;
+                    nearest_root(zr, zi, near_d2, idx);
+                }
+                horner_step<V, M, Degree>(zr, zi, c_re, c_im, nr, ni, dr, di);
+            } else {
+                product_step<V, M>(zr, zi, roots_re, roots_im, nroots, nr, ni, dr, di, near_d2);
+            }
+
+            if constexpr (Trap) {
+                const mask caught = V::mask_and(V::cmp_lt(near_d2, trap), active);
+                trapped_d2 = V::blend(trapped_d2, near_d2, caught);
+                active     = V::mask_andnot(caught, active);
+                if (!V::any(active)) break;
+            }
+
+            // Complex division: step = N / D
+            // denom = dr*dr + di*di
+            vec denom = V::fmadd(dr, dr, V::mul(di, di));
+
+            // Protect against degenerate denominator — set step to 0 for those lanes
+            const mask denom_ok = V::cmp_ge(denom, degen_thresh);
+            denom = V::blend(one, denom, denom_ok);  // avoid division by zero
+
+            const vec inv_denom = V::div(one, denom);
+            vec step_re = V::mul(V::fmadd(nr, dr, V::mul(ni, di)), inv_denom);
+            vec step_im = V::mul(V::fmsub(ni, dr, V::mul(nr, di)), inv_denom);
+
+            // Zero out step for degenerate lanes
+            step_re = V::masked(step_re, denom_ok);
+            step_im = V::masked(step_im, denom_ok);
+
+            // Newton update: z -= step (only for active lanes)
+            const vec new_zr = V::sub(zr, V::masked(step_re, active));
+            const vec new_zi = V::sub(zi, V::masked(step_im, active));
+
+            // Check convergence: |step|^2 < threshold
+            const vec  step_mag2 = V::fmadd(step_re, step_re, V::mul(step_im, step_im));
+            const mask converged = V::cmp_lt(step_mag2, conv_thresh);
+
+            // Deactivate converged lanes; freeze step_mag2 for smooth computation
+            if constexpr (ComputeSmooth) {
+                const mask newly_done = V::mask_and(converged, active);
+                frozen_step_mag2 = V::blend(frozen_step_mag2, step_mag2, newly_done);
+            }
+            active = V::mask_andnot(converged, active);
+
+            // Also deactivate degenerate lanes
+            active = V::mask_and(denom_ok, active);
+
+            zr = new_zr;
+            zi = new_zi;
+
+            // Increment iteration counter for still-active lanes. Newly converged
+            // lanes were removed from active before the increment, so iters_d for
+            // them holds the number of completed iterations.
+            iters_d = V::add_masked(iters_d, active, one);
+
+            // Early exit: all lanes done
+            if (!V::any(active)) break;
+        }
+
+        // Nearest root of every lane at once (trapped lanes sit inside theirs)
+        vec best_d2, best_idx;
+        nearest_root(zr, zi, best_d2, best_idx);
+
+        // Extract iteration counts, roots and (optionally) frozen step_mag2
+        S final_iters[L], final_d2[L], final_idx[L], final_trap[L];
+        V::store(final_iters, iters_d);
+        V::store(final_d2, best_d2);
+        V::store(final_idx, best_idx);
+        if constexpr (Trap)
+            V::store(final_trap, trapped_d2);
+
+        S final_smag2[L];
+        if constexpr (ComputeSmooth)
+            V::store(final_smag2, frozen_step_mag2);
+
+        int*    root   = root_out + g;
+        double* smooth = smooth_out + g;
+        for (int p = 0; p < m; ++p) {
+            const int it = static_cast<int>(final_iters[p]);
+            if (it >= max_iter) {
+                root[p]   = -1;
+                smooth[p] = static_cast<double>(max_iter);
+                continue;
+            }
+            root[p] = (final_d2[p] < 1.0) ? static_cast<int>(final_idx[p]) : -1;
+            if (Trap && final_trap[p] >= 0.0) {
+                smooth[p] = ComputeSmooth
+                    ? final_iters[p] + trap_frac(final_trap[p], trap_r2, newton_method_order(M))
+                    : final_iters[p];
+            } else if constexpr (ComputeSmooth) {
+                const double log_smag2 = std::log(static_cast<double>(final_smag2[p]));
+                const double frac = (log_smag2 < 0.0) ? std::log(thresh) / log_smag2 : 0.0;
+                smooth[p] = final_iters[p] + late + frac;
+            } else {
+                smooth[p] = final_iters[p] + late;
+            }
+        }
+    }
+}
+
+// Kernels for degrees 2..NEWTON_HORNER_DEGREE, indexed by degree; slot 0
+// is the product form for higher degrees
+template <class V, NewtonMethod M, bool ComputeSmooth, bool Trap, int... D>
+constexpr NewtonDegreeTable newton_degree_table(std::integer_sequence<int, D...>)
+{
+    return { simd_newton_impl<V, M, ComputeSmooth, Trap, 0>, nullptr,
+             simd_newton_impl<V, M, ComputeSmooth, Trap, D + 2>... };
+}
+
+template <class V, NewtonMethod M>
+NewtonMethodKernels newton_method_table()
+{
+    using Degrees = std::make_integer_sequence<int, NEWTON_HORNER_DEGREE - 1>;
+    return { newton_degree_table<V, M, false, false>(Degrees{}),
+             newton_degree_table<V, M, true,  false>(Degrees{}),
+             newton_degree_table<V, M, false, true>(Degrees{}),
+             newton_degree_table<V, M, true,  true>(Degrees{}) };
+}
+
+template <class V>
+NewtonKernels newton_table()
+{
+    return { V::lanes,
+             { newton_method_table<V, NewtonMethod::Newton>(),
+               newton_method_table<V, NewtonMethod::Halley>(),
+               newton_method_table<V, NewtonMethod::Householder>() } };
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------
+// Exported tables — newton_kernels_<tier>() and newton_kernels_f32_<tier>()
+// -----------------------------------------------------------------------
+
+const NewtonKernels& SIMD_CAT(newton_kernels_, SIMD_TIER)()
+{
+    static const NewtonKernels table = newton_table<SimdTierV>();
+    return table;
+}
+
+const NewtonKernels& SIMD_CAT(newton_kernels_f32_, SIMD_TIER)()
+{
+    static const NewtonKernels table = newton_table<SimdTierVF>();
+    return table;
+}
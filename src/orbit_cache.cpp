@@ -0,0 +1,193 @@
+#include "orbit_cache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char     ORBIT_MAGIC[8] = { 'F', 'X', 'O', 'R', 'B', 'I', 'T', 0 };
+constexpr uint32_t ORBIT_VERSION  = 1;
+constexpr const char* ORBIT_EXT   = ".orbit";
+
+// File layout: this header, then re[last + 1], im[last + 1] and, for
+// folding formulas, sq_re[last], sq_im[last] — native doubles, unpadded.
+struct OrbitFileHeader {
+    char     magic[8];
+    uint32_t version;
+    int32_t  power;
+    uint8_t  abs_re, abs_im, conj, has_sq;
+    int32_t  limbs;
+    int32_t  max_iter;
+    int32_t  last;
+    uint32_t cr[BigFix::LIMBS], ci[BigFix::LIMBS];
+    uint32_t zr[BigFix::LIMBS], zi[BigFix::LIMBS];
+};
+static_assert(sizeof(OrbitFileHeader) % sizeof(double) == 0,
+              "orbit arrays must start 8-byte aligned");
+
+// FNV-1a
+uint64_t hash_bytes(uint64_t h, const void* p, size_t n)
+{
+    const auto* b = static_cast<const unsigned char*>(p);
+    for (size_t k = 0; k < n; ++k)
+        h = (h ^ b[k]) * 0x100000001b3ull;
+    return h;
+}
+
+bool write_doubles(FILE* fp, const std::vector<double>& v)
+{
+    return std::fwrite(v.data(), sizeof(double), v.size(), fp) == v.size();
+}
+
+bool read_doubles(FILE* fp, std::vector<double>& v, size_t n)
+{
+    v.resize(n);
+    return std::fread(v.data(), sizeof(double), n, fp) == n;
+}
+
+} // namespace
+
+OrbitCache::OrbitCache(std::string d, uint64_t cap)
+    : dir(std::move(d)), max_bytes(cap)
+{
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+}
+
+std::string OrbitCache::path_for(const PerturbFormula& formula,
+                                 const BigFix& cr, const BigFix& ci, int limbs) const
+{
+    const int32_t key[5] = { formula.power, formula.abs_re, formula.abs_im, formula.conj, limbs };
+    uint64_t h = 0xcbf29ce484222325ull;
+    h = hash_bytes(h, key, sizeof(key));
+    h = hash_bytes(h, cr.limb, sizeof(cr.limb));
+    h = hash_bytes(h, ci.limb, sizeof(ci.limb));
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx%s", static_cast<unsigned long long>(h), ORBIT_EXT);
+    return (fs::path(dir) / name).string();
+}
+
+bool OrbitCache::load(ReferenceOrbit& ref, const PerturbFormula& formula,
+                      const BigFix& cr, const BigFix& ci, int limbs) const
+{
+    const std::string path = path_for(formula, cr, ci, limbs);
+    FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) return false;
+
+    OrbitFileHeader h;
+    bool ok = std::fread(&h, sizeof(h), 1, fp) == 1 &&
+              std::memcmp(h.magic, ORBIT_MAGIC, sizeof(h.magic)) == 0 &&
+              h.version == ORBIT_VERSION &&
+              h.power == formula.power && h.abs_re == formula.abs_re &&
+              h.abs_im == formula.abs_im && h.conj == formula.conj &&
+              h.has_sq == formula.folds() && h.limbs == limbs &&
+              std::memcmp(h.cr, cr.limb, sizeof(h.cr)) == 0 &&
+              std::memcmp(h.ci, ci.limb, sizeof(h.ci)) == 0 &&
+              h.last >= 0 && h.last <= h.max_iter;
+
+    // The arrays must fill the rest of the file exactly; checked before
+    // anything is allocated, so a corrupt last cannot ask for gigabytes
+    if (ok) {
+        const size_t n     = static_cast<size_t>(h.last) + 1;
+        const size_t count = 2 * n + (h.has_sq ? 2 * (n - 1) : 0);
+        std::error_code ec;
+        const uintmax_t size = fs::file_size(path, ec);
+        ok = !ec && size == sizeof(OrbitFileHeader) + count * sizeof(double);
+    }
+    ReferenceOrbit r;
+    if (ok) {
+        const size_t n = static_cast<size_t>(h.last) + 1;
+        ok = read_doubles(fp, r.re, n) && read_doubles(fp, r.im, n) &&
+             (!h.has_sq || (read_doubles(fp, r.sq_re, n - 1) && read_doubles(fp, r.sq_im, n - 1)));
+    }
+    std::fclose(fp);
+    if (!ok) return false;
+
+    std::copy(h.zr, h.zr + BigFix::LIMBS, r.zr.limb);
+    std::copy(h.zi, h.zi + BigFix::LIMBS, r.zi.limb);
+    r.last     = h.last;
+    r.formula  = formula;
+    r.cr       = cr;
+    r.ci       = ci;
+    r.max_iter = h.max_iter;
+    r.limbs    = limbs;
+    ref = std::move(r);
+
+    // Most recently used
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void OrbitCache::store(const ReferenceOrbit& ref) const
+{
+    OrbitFileHeader h = {};
+    std::memcpy(h.magic, ORBIT_MAGIC, sizeof(h.magic));
+    h.version  = ORBIT_VERSION;
+    h.power    = ref.formula.power;
+    h.abs_re   = ref.formula.abs_re;
+    h.abs_im   = ref.formula.abs_im;
+    h.conj     = ref.formula.conj;
+    h.has_sq   = ref.formula.folds();
+    h.limbs    = ref.limbs;
+    h.max_iter = ref.max_iter;
+    h.last     = ref.last;
+    std::copy(ref.cr.limb, ref.cr.limb + BigFix::LIMBS, h.cr);
+    std::copy(ref.ci.limb, ref.ci.limb + BigFix::LIMBS, h.ci);
+    std::copy(ref.zr.limb, ref.zr.limb + BigFix::LIMBS, h.zr);
+    std::copy(ref.zi.limb, ref.zi.limb + BigFix::LIMBS, h.zi);
+
+    // Written aside and renamed over the old file, so a reader never sees
+    // a partial orbit
+    const std::string path = path_for(ref.formula, ref.cr, ref.ci, ref.limbs);
+    const std::string tmp  = path + ".tmp";
+    FILE* fp = std::fopen(tmp.c_str(), "wb");
+    if (!fp) return;
+    bool ok = std::fwrite(&h, sizeof(h), 1, fp) == 1 &&
+              write_doubles(fp, ref.re) && write_doubles(fp, ref.im) &&
+              write_doubles(fp, ref.sq_re) && write_doubles(fp, ref.sq_im);
+    ok = (std::fclose(fp) == 0) && ok;
+
+    std::error_code ec;
+    if (ok) fs::rename(tmp, path, ec);
+    if (!ok || ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+    evict();
+}
+
+void OrbitCache::evict() const
+{
+    struct Entry {
+        fs::path            path;
+        fs::file_time_type  time;
+        uint64_t            size;
+    };
+    std::vector<Entry> files;
+    uint64_t total = 0;
+
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() != ORBIT_EXT) continue;
+        std::error_code e1, e2;
+        const uint64_t           size = it->file_size(e1);
+        const fs::file_time_type time = it->last_write_time(e2);
+        if (e1 || e2) continue;
+        files.push_back({ it->path(), time, size });
+        total += size;
+    }
+    if (total <= max_bytes) return;
+
+    std::sort(files.begin(), files.end(),
+              [](const Entry& a, const Entry& b) { return a.time < b.time; });
+    for (const Entry& f : files) {
+        if (total <= max_bytes) break;
+        if (fs::remove(f.path, ec)) total -= f.size;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+// On-disk cache of deep-zoom reference orbits.
+//
+// A reference orbit at extreme depth is a long serial BigFix computation
+// that zoom animations and revisited locations would otherwise repeat. Each
+// orbit is one file named by a hash of its key (formula, power, centre and
+// limb count) and laid out to be memory-mappable: a fixed header carrying
+// the full key and the exact final Z, then the double arrays back to back
+// at 8-byte aligned offsets, which load() reads straight into the orbit's
+// vectors. A loaded orbit that stopped short of a later request is
+// extended from that final Z rather than recomputed (see
+// compute_reference_orbit).
+//
+// Eviction is least-recently-used by file modification time: a hit touches
+// its file, and every store removes the oldest files until the directory
+// is back under the size cap. Failures of any kind only cost a recompute.
+
+#include "perturbation.hpp"
+
+#include <cstdint>
+#include <string>
+
+class OrbitCache {
+public:
+    // Creates dir if needed; max_bytes caps the total size of its orbit files
+    OrbitCache(std::string dir, uint64_t max_bytes);
+
+    // Fills ref with the cached orbit of this point, of whatever length it
+    // was stored at. False (ref untouched) when there is none.
+    bool load(ReferenceOrbit& ref, const PerturbFormula& formula,
+              const BigFix& cr, const BigFix& ci, int limbs) const;
+
+    // Writes ref (replacing any older orbit of the same point), then evicts
+    void store(const ReferenceOrbit& ref) const;
+
+    const std::string& directory() const { return dir; }
+
+private:
+    std::string path_for(const PerturbFormula& formula,
+                         const BigFix& cr, const BigFix& ci, int limbs) const;
+    void evict() const;
+
+    std::string dir;
+    uint64_t    max_bytes;
+};
@@ -25,8 +25,8 @@ inline uint32_t palette_color(double smooth, int max_iter, int palette, int pal_
     return g_palette_lut[palette][idx];
 }
 
-// Newton fractal root colors — 8 distinct hues, fully opaque.
-// Layout: 0xAABBGGRR (little-endian memory: R, G, B, A)
+// Newton fractal root colors — the first 8 roots get these distinct hues,
+// fully opaque. Layout: 0xAABBGGRR (little-endian memory: R, G, B, A)
 static constexpr uint32_t NEWTON_ROOT_COLORS[8] = {
     0xFF0000FF,  // red
     0xFF00CC00,  // green
@@ -38,12 +38,40 @@ static constexpr uint32_t NEWTON_ROOT_COLORS[8] = {
     0xFF00FF88,  // lime
 };
 
+// Color of Newton root `root` (>= 0). Roots past the table step the hue by
+// the golden angle, which keeps any number of neighbours apart, and alternate
+// between two saturation/value pairs.
+inline uint32_t newton_root_color(int root)
+{
+    if (root < 8) return NEWTON_ROOT_COLORS[root];
+
+    double h = (root - 8) * 0.6180339887498949 + 0.1;   // turns
+    h = (h - static_cast<int>(h)) * 6.0;
+    const double s = (root & 1) ? 0.65 : 1.0;
+    const double v = (root & 2) ? 0.8 : 1.0;
+    const int    i = static_cast<int>(h);
+    const double f = h - i;
+    const double p = v * (1.0 - s), q = v * (1.0 - s * f), t = v * (1.0 - s * (1.0 - f));
+    double r, g, b;
+    switch (i) {
+        case 0:  r = v; g = t; b = p; break;
+        case 1:  r = q; g = v; b = p; break;
+        case 2:  r = p; g = v; b = t; break;
+        case 3:  r = p; g = q; b = v; break;
+        case 4:  r = t; g = p; b = v; break;
+        default: r = v; g = p; b = q; break;
+    }
+    return 0xFF000000u | (static_cast<uint32_t>(b * 255.0) << 16)
+                       | (static_cast<uint32_t>(g * 255.0) << 8)
+                       | static_cast<uint32_t>(r * 255.0);
+}
+
 // Map a Newton result to a 32-bit RGBA pixel.
 // root < 0 -> black (no convergence). Otherwise: base color dimmed by iteration count.
 inline uint32_t newton_color(int root, int iters, int max_iter)
 {
     if (root < 0) return 0xFF000000u;
-    const uint32_t base = NEWTON_ROOT_COLORS[root & 7];
+    const uint32_t base = newton_root_color(root);
     const double brightness = 1.0 - 0.6 * (static_cast<double>(iters) / max_iter);
     const uint8_t r = static_cast<uint8_t>((base & 0xFF)       * brightness);
     const uint8_t g = static_cast<uint8_t>(((base >> 8) & 0xFF) * brightness);
@@ -0,0 +1,240 @@
+#include "perturbation.hpp"
+
+namespace {
+
+constexpr int T = SeriesApprox::TERMS;
+
+// One reference step of the scaled coefficients:
+// b_k' = 2 Z b_k + sum_{i+j=k} b_i b_j, plus r for b_1 (dc = r u).
+// Stored times 2^-exp, each product needs a factor 2^exp; it is split over
+// both operands (h1 h2 = 2^exp) so neither factor underflows on its own.
+void series_step(double* br, double* bi, double zr, double zi, double r, int exp)
+{
+    const double h1 = std::ldexp(1.0, exp / 2), h2 = std::ldexp(1.0, exp - exp / 2);
+    double xr[T], xi[T], yr[T], yi[T];
+    for (int k = 0; k < T; ++k) {
+        xr[k] = br[k] * h1;  xi[k] = bi[k] * h1;
+        yr[k] = br[k] * h2;  yi[k] = bi[k] * h2;
+    }
+    double nr[T], ni[T];
+    for (int k = 0; k < T; ++k) {            // term k+1
+        double tr = 2.0 * (zr * br[k] - zi * bi[k]);
+        double ti = 2.0 * (zr * bi[k] + zi * br[k]);
+        for (int i = 0; i < k; ++i) {        // b_(i+1) * b_(k-i)
+            const int j = k - 1 - i;
+            tr += xr[i] * yr[j] - xi[i] * yi[j];
+            ti += xr[i] * yi[j] + xi[i] * yr[j];
+        }
+        nr[k] = tr;
+        ni[k] = ti;
+    }
+    nr[0] += r;
+    std::copy(nr, nr + T, br);
+    std::copy(ni, ni + T, bi);
+}
+
+// Series at iteration n (coefficients start at zero: dz_0 = 0)
+SeriesApprox series_at(const ReferenceOrbit& ref, double r, int exp, int n)
+{
+    SeriesApprox sa;
+    sa.skip   = n;
+    sa.exp    = exp;
+    sa.radius = r;
+    for (int m = 0; m < n; ++m)
+        series_step(sa.re, sa.im, ref.re[m], ref.im[m], r, exp);
+    return sa;
+}
+
+// Does the series match plain perturbation at probe offset dc?
+bool series_matches(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                    double dcr, double dci)
+{
+    double dr = 0.0, di = 0.0;
+    for (int m = 0; m < sa.skip; ++m) {
+        const double zr = ref.re[m] + dr, zi = ref.im[m] + di;
+        if (zr*zr + zi*zi > 4.0) return false;   // probe escaped before the skip
+        const double tr = 2.0 * ref.re[m] + dr;
+        const double ti = 2.0 * ref.im[m] + di;
+        const double new_dr = tr*dr - ti*di + dcr;
+        di = tr*di + ti*dr + dci;
+        dr = new_dr;
+    }
+    double sr, si;
+    sa.eval(dcr, dci, sr, si);
+    return std::hypot(sr - dr, si - di) <= SERIES_TOLERANCE * std::hypot(dr, di);
+}
+
+// series_matches() past double range: dc and the series are scaled by
+// 2^-sa.exp, the probe iterates in FloatExp
+bool series_matches_fe(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                       double dcr, double dci)
+{
+    const FloatExp cr(dcr, sa.exp), ci(dci, sa.exp);
+    FloatExp dr, di;
+    for (int m = 0; m < sa.skip; ++m) {
+        const double zr = ref.re[m] + dr.to_double(), zi = ref.im[m] + di.to_double();
+        if (zr*zr + zi*zi > 4.0) return false;
+        const FloatExp tr = FloatExp(2.0 * ref.re[m]) + dr;
+        const FloatExp ti = FloatExp(2.0 * ref.im[m]) + di;
+        const FloatExp new_dr = tr*dr - ti*di + cr;
+        di = tr*di + ti*dr + ci;
+        dr = new_dr;
+    }
+    double sr, si;
+    sa.eval(dcr, dci, sr, si);
+    const FloatExp er = FloatExp(sr, sa.exp) - dr, ei = FloatExp(si, sa.exp) - di;
+    return er*er + ei*ei <= (dr*dr + di*di) * (SERIES_TOLERANCE * SERIES_TOLERANCE);
+}
+
+} // namespace
+
+void compute_reference_orbit(ReferenceOrbit& ref, const PerturbFormula& formula,
+                             const BigFix& cr, const BigFix& ci, int max_iter, int limbs)
+{
+    if (ref.covers(formula, cr, ci, max_iter, limbs))
+        return;
+
+    const bool extend = ref.same_point(formula, cr, ci, limbs);
+    if (!extend) {
+        ref.re.assign(1, 0.0);
+        ref.im.assign(1, 0.0);
+        ref.sq_re.clear();
+        ref.sq_im.clear();
+        ref.zr = ref.zi = BigFix();
+    }
+    ref.re.reserve(max_iter + 1);
+    ref.im.reserve(max_iter + 1);
+    if (formula.folds()) {
+        ref.sq_re.reserve(max_iter);
+        ref.sq_im.reserve(max_iter);
+    }
+    ref.last = max_iter;
+
+    BigFix& zr = ref.zr;
+    BigFix& zi = ref.zi;
+    for (int n = extend ? ref.max_iter + 1 : 1; n <= max_iter; ++n) {
+        BigFix pr, pi;
+        if (formula.power == 2) {
+            pr = BigFix::sqr(zr, limbs) - BigFix::sqr(zi, limbs);
+            pi = BigFix::twice(BigFix::mul(zr, zi, limbs));
+            if (formula.folds()) {   // Z_(n-1)^2 before the fold
+                ref.sq_re.push_back(pr.to_double());
+                ref.sq_im.push_back(pi.to_double());
+            }
+            if (formula.abs_re && pr.negative()) pr.negate();
+            if (formula.abs_im && pi.negative()) pi.negate();
+        } else {
+            pr = zr;
+            pi = zi;
+            for (int k = 1; k < formula.power; ++k) {
+                const BigFix new_pr = BigFix::mul(pr, zr, limbs) - BigFix::mul(pi, zi, limbs);
+                pi = BigFix::mul(pr, zi, limbs) + BigFix::mul(pi, zr, limbs);
+                pr = new_pr;
+            }
+        }
+        if (formula.conj) pi.negate();
+        zr = pr + cr;
+        zi = pi + ci;
+
+        const double r = zr.to_double(), i = zi.to_double();
+        ref.re.push_back(r);
+        ref.im.push_back(i);
+        if (r*r + i*i > 4.0) { ref.last = n; break; }
+    }
+
+    ref.formula  = formula;
+    ref.cr       = cr;
+    ref.ci       = ci;
+    ref.max_iter = max_iter;
+    ref.limbs    = limbs;
+}
+
+SeriesApprox compute_series(const ReferenceOrbit& ref, int W, int H, double scale,
+                            int scale_exp, int max_iter)
+{
+    const double r     = 0.5 * std::hypot(static_cast<double>(W), static_cast<double>(H)) * scale;
+    const int    limit = std::min(ref.last, max_iter) - 1;
+    if (!ref.formula.quadratic())
+        return series_at(ref, r, scale_exp, 0);
+
+    // Advance while the last term stays negligible next to the first
+    double br[T] = {}, bi[T] = {};
+    int n = 0;
+    while (n < limit) {
+        double nr[T], ni[T];
+        std::copy(br, br + T, nr);
+        std::copy(bi, bi + T, ni);
+        series_step(nr, ni, ref.re[n], ref.im[n], r, scale_exp);
+        const double first = std::hypot(nr[0], ni[0]);
+        const double last  = std::hypot(nr[T - 1], ni[T - 1]);
+        if (!std::isfinite(first) || !(last <= SERIES_TOLERANCE * first))
+            break;
+        std::copy(nr, nr + T, br);
+        std::copy(ni, ni + T, bi);
+        ++n;
+    }
+
+    // Probe pixels: corners and edge midpoints, where |dc| is largest
+    const double hx = 0.5 * W * scale, hy = 0.5 * H * scale;
+    const double probes[8][2] = {
+        {-hx, -hy}, { hx, -hy}, {-hx,  hy}, { hx,  hy},
+        {-hx, 0.0}, { hx, 0.0}, {0.0, -hy}, {0.0,  hy},
+    };
+    auto valid = [&](const SeriesApprox& sa) {
+        for (const auto& p : probes)
+            if (!(scale_exp ? series_matches_fe(ref, sa, p[0], p[1])
+                            : series_matches(ref, sa, p[0], p[1]))) return false;
+        return true;
+    };
+
+    SeriesApprox best = series_at(ref, r, scale_exp, n);
+    if (n == 0 || valid(best))
+        return best;
+
+    // Largest skip in [0, n) the probes accept (0 always is)
+    int lo = 0, hi = n;
+    best = series_at(ref, r, scale_exp, 0);
+    while (hi - lo > 1) {
+        const int mid = (lo + hi) / 2;
+        SeriesApprox sa = series_at(ref, r, scale_exp, mid);
+        if (valid(sa)) { lo = mid; best = sa; }
+        else           { hi = mid; }
+    }
+    return best;
+}
+
+void compute_bla(BlaTable& bla, const ReferenceOrbit& ref, double dc_max)
+{
+    bla.levels.clear();
+    if (!ref.formula.quadratic())
+        return;
+
+    // Level 0: one step per reference index below last
+    std::vector<BlaStep> prev(ref.last);
+    for (int n = 0; n < ref.last; ++n) {
+        const double ar = 2.0 * ref.re[n], ai = 2.0 * ref.im[n];
+        const double r  = BLA_EPSILON * std::hypot(ar, ai);
+        prev[n] = {ar, ai, 1.0, 0.0, r * r};
+    }
+
+    bla.levels.emplace_back();   // level 0 is iterated exactly
+    while (prev.size() >= 2) {
+        std::vector<BlaStep> cur(prev.size() / 2);
+        for (size_t j = 0; j < cur.size(); ++j) {
+            const BlaStep& x = prev[2 * j];
+            const BlaStep& y = prev[2 * j + 1];
+            BlaStep& s = cur[j];
+            s.ar = y.ar * x.ar - y.ai * x.ai;
+            s.ai = y.ar * x.ai + y.ai * x.ar;
+            s.br = y.ar * x.br - y.ai * x.bi + y.br;
+            s.bi = y.ar * x.bi + y.ai * x.br + y.bi;
+            const double rx = std::sqrt(x.r2);
+            const double ry = std::max(0.0, std::sqrt(y.r2) - std::hypot(x.br, x.bi) * dc_max)
+                            / std::hypot(x.ar, x.ai);
+            const double r  = std::min(rx, ry);
+            s.r2 = std::isfinite(r) ? r * r : 0.0;
+        }
+        prev = cur;
+        bla.levels.push_back(std::move(cur));
+    }
+}
@@ -0,0 +1,355 @@
+#pragma once
+
+// Perturbation rendering for deep zooms (Mandelbrot-mode escape-time
+// formulas except Collatz).
+//
+// Past ~1e-13 view widths, doubles can no longer tell neighbouring pixels
+// apart. Instead one reference orbit Z_n is iterated in BigFix at the view
+// centre C, and each pixel c = C + dc only iterates its offset
+// dz_n = z_n - Z_n from that orbit:
+//
+//   dz_{n+1} = 2 Z_n dz_n + dz_n^2 + dc = (2 Z_n + dz_n) dz_n + dc
+//
+// dz and dc are tiny, but a double keeps full relative precision at any
+// magnitude, so the per-pixel work is plain double arithmetic. Z_n is O(1)
+// and is stored rounded to double.
+//
+// A pixel that outlives the reference (Z escaped first) is rebased onto
+// the start of the orbit: dz = z, n = 0 (Z_0 = 0), and iteration continues.
+//
+// Series approximation: for the first iterations every pixel's offset is a
+// smooth function of its dc, dz_n = sum_k a_k,n dc^k, with coefficients
+// iterated once per view along the reference:
+//
+//   a_1' = 2 Z a_1 + 1,   a_k' = 2 Z a_k + sum_{i+j=k} a_i a_j
+//
+// Pixels start at the last iteration where the truncated series is still
+// accurate, and skip everything before it.
+//
+// Bilinear approximation (BLA): as long as |dz| stays tiny next to Z, the
+// dz^2 term is negligible and l steps from index n collapse into one linear
+// map, dz_{n+l} = A dz_n + B dc. For one step A = 2 Z_n, B = 1; two
+// neighbouring steps x then y merge into A = A_y A_x, B = A_y B_x + B_y.
+// A table of power-of-two merges lets a pixel jump anywhere along the orbit
+// (not just at the start) and step normally wherever no jump is valid.
+//
+// Past double's exponent range (view widths below 2^-900, see
+// ViewState::view_exp) dc and the early dz no longer fit a double. The
+// series and the pixel offsets are then kept scaled by 2^-exp, and each
+// pixel iterates dz as a FloatExp only until it is back in double range
+// (the lead-in); from there dc is negligible next to dz and the plain
+// double iteration takes over. Views above 2^-900 never touch FloatExp.
+//
+// The other formulas iterate z' = fold(z^n) + c (PerturbFormula). z^n
+// perturbs as (Z + dz)^n - Z^n = dz * sum_j (Z + dz)^j Z^(n-1-j), and
+// Mandelbar conjugates the result. The Burning Ship family folds Re and/or
+// Im of z^2 with an absolute value; the offset goes through the fold
+// sign-aware, |X + x| - |X| without cancellation (diffabs), which needs the
+// unfolded Re / Im of Z_n^2 from the reference. Neither is holomorphic in
+// dc, so only plain z^2 + c uses the series and BLA; the others iterate
+// every step from dz_0 = 0.
+//
+// Glitches: where a pixel's z = Z + dz passes much closer to 0 than Z does,
+// dz has nearly cancelled Z and the reference's rounding (relative to |Z|)
+// swamps the pixel's own digits; whole regions then copy the reference's
+// behaviour as flat blobs. Pauldelbrot's test flags those pixels
+// (|z|^2 < glitch_tol |Z|^2) and the kernels stop them with PERTURB_GLITCH;
+// the renderer re-renders them against extra references placed inside the
+// glitched region (see CpuRenderer::correct_glitches).
+
+#include "bigfix.hpp"
+#include "floatexp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// z' = fold(z^power) + c: abs_re / abs_im take |Re| / |Im| of z^2 (power 2
+// only: Celtic, Burning Ship, Buffalo), conj flips the sign of Im
+// (Mandelbar, conj(z)^n = conj(z^n)).
+struct PerturbFormula {
+    int  power  = 2;
+    bool abs_re = false;
+    bool abs_im = false;
+    bool conj   = false;
+
+    bool folds() const { return abs_re || abs_im; }
+    // Plain z^2 + c: the only formula with a series and a BLA table
+    bool quadratic() const { return power == 2 && !folds() && !conj; }
+
+    friend bool operator==(const PerturbFormula& a, const PerturbFormula& b)
+    {
+        return a.power == b.power && a.abs_re == b.abs_re &&
+               a.abs_im == b.abs_im && a.conj == b.conj;
+    }
+};
+
+struct ReferenceOrbit {
+    std::vector<double> re, im;   // Z_0 .. Z_last rounded to double (Z_0 = 0)
+    // Re / Im of Z_n^2 before the fold, rounded from the exact value so a
+    // sign is never lost near zero (folding formulas only, else empty)
+    std::vector<double> sq_re, sq_im;
+    int last = 0;                 // final index: where Z escaped, or max_iter
+    BigFix zr, zi;                // Z_last at full precision, to extend the orbit
+
+    // What the orbit was computed for; reused while a view matches
+    PerturbFormula formula;
+    BigFix cr, ci;
+    int    max_iter = -1;
+    int    limbs    = 0;
+
+    bool same_point(const PerturbFormula& f, const BigFix& r, const BigFix& i, int n) const
+    {
+        return formula == f && cr == r && ci == i && limbs == n;
+    }
+    // An orbit that escaped is complete; one that did not serves any
+    // request up to its own max_iter
+    bool covers(const PerturbFormula& f, const BigFix& r, const BigFix& i, int iters, int n) const
+    {
+        return same_point(f, r, i, n) && (last < max_iter || max_iter >= iters);
+    }
+};
+
+// Truncated series for one view. Coefficients are stored scaled by the
+// view radius r (b_k = a_k r^k) so they stay in range at any depth:
+// dz_skip = sum_k b_k u^k with u = dc / r, |u| <= 1 inside the view.
+// Past double range, radius, coefficients, dc and the resulting dz are
+// all stored times 2^-exp.
+struct SeriesApprox {
+    static constexpr int TERMS = 8;
+    int    skip   = 0;       // iterations every pixel starts past
+    int    exp    = 0;       // binary scale of everything below (0 in double range)
+    double radius = 1.0;     // r: largest |dc| of the view
+    double re[TERMS] = {};   // b_1 .. b_TERMS at iteration skip
+    double im[TERMS] = {};
+
+    // dz at iteration skip for offset dc (Horner in u)
+    void eval(double dcr, double dci, double& dzr, double& dzi) const
+    {
+        const double ur = dcr / radius, ui = dci / radius;
+        double ar = re[TERMS - 1], ai = im[TERMS - 1];
+        for (int k = TERMS - 2; k >= 0; --k) {
+            const double t = ar*ur - ai*ui + re[k];
+            ai = ar*ui + ai*ur + im[k];
+            ar = t;
+        }
+        dzr = ar*ur - ai*ui;
+        dzi = ar*ui + ai*ur;
+    }
+};
+
+// Relative accuracy the series must hold at the probe pixels (and the size
+// of its last term next to the first). Looser values skip only a few more
+// iterations but visibly disturb pixels on chaotic boundaries.
+constexpr double SERIES_TOLERANCE = 1e-12;
+
+// A merged step is valid while |dz| < radius. One step keeps the dropped
+// dz^2 below BLA_EPSILON of the kept 2 Z dz: radius = BLA_EPSILON |2 Z_n|.
+// x then y need |dz| < r_x and |A_x dz + B_x dc| < r_y for every dc of the
+// view: radius = min(r_x, (r_y - |B_x| |dc|max) / |A_x|).
+// The dropped terms add up over a long merge, so anything looser than
+// double rounding (even 2^-40) visibly disturbs pixels on the boundary.
+constexpr double BLA_EPSILON = 0x1p-53;
+
+struct BlaStep {
+    double ar, ai;   // A
+    double br, bi;   // B
+    double r2;       // radius^2
+};
+
+struct BlaTable {
+    // levels[k][j]: the 2^k steps from reference index j * 2^k, full blocks
+    // below ref.last only. Level 0 (single steps) is dropped once merged:
+    // those are iterated exactly instead.
+    std::vector<std::vector<BlaStep>> levels;
+
+    // Longest valid step from index n for |dz|^2 = dz2 spanning at most
+    // max_len iterations, or null. A merge is never valid where one of its
+    // halves is not, so the search stops at the first level that fails.
+    const BlaStep* lookup(int n, double dz2, int max_len, int& len) const
+    {
+        const BlaStep* best = nullptr;
+        for (int k = 1; k < static_cast<int>(levels.size()); ++k) {
+            if ((n & ((1 << k) - 1)) != 0 || (1 << k) > max_len) break;
+            const std::vector<BlaStep>& lv = levels[k];
+            const size_t j = static_cast<size_t>(n) >> k;
+            if (j >= lv.size() || !(dz2 < lv[j].r2)) break;
+            best = &lv[j];
+            len  = 1 << k;
+        }
+        return best;
+    }
+
+    // Take valid steps from reference index n, iteration i, while there are
+    // any; each stops one short of max_iter so the last iteration is always
+    // a plain one.
+    void advance(double dcr, double dci, int max_iter,
+                 double& dr, double& di, int& n, int& i) const
+    {
+        int len;
+        while (const BlaStep* s = lookup(n, dr*dr + di*di, max_iter - 1 - i, len)) {
+            const double nr = s->ar*dr - s->ai*di + s->br*dcr - s->bi*dci;
+            di = s->ar*di + s->ai*dr + s->br*dci + s->bi*dcr;
+            dr = nr;
+            n += len;
+            i += len;
+        }
+    }
+};
+
+// Iterate Z_{n+1} = fold(Z_n^power) + C with `limbs` BigFix limbs until
+// |Z|^2 > 4 or max_iter. Leaves ref untouched when it already covers this
+// request, and extends it from Z_last when it is a shorter orbit of the same
+// point.
+void compute_reference_orbit(ReferenceOrbit& ref, const PerturbFormula& formula,
+                             const BigFix& cr, const BigFix& ci, int max_iter, int limbs);
+
+// Series for a W x H view at pixel scale scale * 2^scale_exp centred on
+// ref's point: the coefficients are advanced while the last term stays
+// negligible, then the skip is checked against plain perturbation at probe
+// pixels on the view's corners and edges and lowered until they agree.
+// skip stays below both ref.last and max_iter; exp = scale_exp. Formulas
+// other than plain z^2 + c get skip 0.
+SeriesApprox compute_series(const ReferenceOrbit& ref, int W, int H, double scale,
+                            int scale_exp, int max_iter);
+
+// BLA table along ref for a view whose offsets reach |dc| = dc_max (empty
+// for formulas other than plain z^2 + c).
+void compute_bla(BlaTable& bla, const ReferenceOrbit& ref, double dc_max);
+
+// Where a pixel's plain double iteration starts: offset dz, reference index
+// n and iteration count i
+struct DeepStart {
+    double dr, di;
+    int    n, i;
+};
+
+// The lead-in hands dz over to double iteration once either part reaches
+// 2^FLOATEXP_HANDOFF_EXP: far above the denormals, and far above every dc
+// of a view narrow enough to need it (< 2^-900), so dropping dc is exact.
+constexpr int FLOATEXP_HANDOFF_EXP = -700;
+
+// Pauldelbrot's test on squared magnitudes: |z| < 1e-3 |Z|. A glitch_tol
+// of 0 turns detection off.
+constexpr double GLITCH_TOLERANCE = 1e-6;
+// Kernel result for a glitched pixel (smooth counts are never negative)
+constexpr double PERTURB_GLITCH = -1.0;
+
+// |a + d| - |a| for a reference value a and its offset d. Where the sign
+// holds the result is d or -d exactly; only across zero does a enter.
+inline double diffabs(double a, double d)
+{
+    const double s = a + d;
+    if (a >= 0.0) return s >= 0.0 ? d : -(2.0 * a + d);
+    return s > 0.0 ? 2.0 * a + d : -d;
+}
+
+inline FloatExp diffabs(double a, const FloatExp& d)
+{
+    const FloatExp s = FloatExp(a) + d;
+    if (a >= 0.0) return s.m >= 0.0 ? d : -(FloatExp(2.0 * a) + d);
+    return s.m > 0.0 ? FloatExp(2.0 * a) + d : -d;
+}
+
+// One offset step from reference index n for ref.formula, in double or
+// FloatExp: dz' = fold((Z + dz)^p) - fold(Z^p) + dc (Im negated first for
+// Mandelbar)
+template<class T>
+inline void perturb_step(const ReferenceOrbit& ref, int n, T& dr, T& di,
+                         const T& dcr, const T& dci)
+{
+    const PerturbFormula& f = ref.formula;
+    T er, ei;
+    if (f.power == 2) {
+        // (Z + dz)^2 - Z^2 = (2Z + dz) dz
+        const T tr = T(2.0 * ref.re[n]) + dr;
+        const T ti = T(2.0 * ref.im[n]) + di;
+        er = tr*dr - ti*di;
+        ei = tr*di + ti*dr;
+        if (f.abs_re) er = diffabs(ref.sq_re[n], er);
+        if (f.abs_im) ei = diffabs(ref.sq_im[n], ei);
+    } else {
+        // (Z + dz)^p - Z^p = dz * sum_j w^j Z^(p-1-j), w = Z + dz;
+        // Horner in Z with the powers of w built alongside
+        const T zr(ref.re[n]), zi(ref.im[n]);
+        const T wr = zr + dr, wi = zi + di;
+        T sr(1.0), si(0.0), pr(1.0), pi(0.0);
+        for (int k = 1; k < f.power; ++k) {
+            const T new_pr = pr*wr - pi*wi;
+            pi = pr*wi + pi*wr;
+            pr = new_pr;
+            const T new_sr = sr*zr - si*zi + pr;
+            si = sr*zi + si*zr + pi;
+            sr = new_sr;
+        }
+        er = sr*dr - si*di;
+        ei = sr*di + si*dr;
+    }
+    dr = er + dcr;
+    di = (f.conj ? -ei : ei) + dci;
+}
+
+// Floatexp lead-in for offset dc * 2^sa.exp: the series value, iterated as
+// FloatExp until it is in double range. Until then |dz| is far below Z's
+// escape margin, so the pixel cannot escape; the lead-in also stops at the
+// end of the reference (the double iteration rebases or escapes there) and
+// one short of max_iter, so the last iteration is a plain one.
+inline DeepStart perturb_lead_in(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                                 double dcr, double dci, int max_iter)
+{
+    double sr, si;
+    sa.eval(dcr, dci, sr, si);
+    FloatExp       dr(sr, sa.exp),  di(si, sa.exp);
+    const FloatExp cr(dcr, sa.exp), ci(dci, sa.exp);
+    int n = sa.skip;
+    while (n < ref.last && n + 1 < max_iter && std::max(dr.e, di.e) < FLOATEXP_HANDOFF_EXP) {
+        perturb_step(ref, n, dr, di, cr, ci);
+        ++n;
+    }
+    return { dr.to_double(), di.to_double(), n, n };
+}
+
+// Plain double perturbation of pixel C + (dcr, dci) from offset (dr, di) at
+// reference index n, iteration i; takes BLA steps wherever one is valid.
+// PERTURB_GLITCH for a pixel failing the glitch test.
+inline double perturb_from(const ReferenceOrbit& ref, const BlaTable& bla,
+                           double dcr, double dci, double dr, double di,
+                           int n, int i, int max_iter, double glitch_tol)
+{
+    const double log_p = std::log(static_cast<double>(ref.formula.power));
+    for (;; ++i, ++n) {
+        bla.advance(dcr, dci, max_iter, dr, di, n, i);
+        if (i >= max_iter) break;
+        const double zr = ref.re[n] + dr;
+        const double zi = ref.im[n] + di;
+        const double mag2 = zr*zr + zi*zi;
+        if (mag2 > 4.0) {
+            const double log_zn = std::log(mag2) * 0.5;
+            const double nu     = std::log(log_zn / log_p) / log_p;
+            return std::max(0.0, static_cast<double>(i) + 1.0 - nu);
+        }
+        if (n == ref.last) { dr = zr; di = zi; n = 0; }   // rebase
+        else if (mag2 < glitch_tol * (ref.re[n]*ref.re[n] + ref.im[n]*ref.im[n]))
+            return PERTURB_GLITCH;
+        perturb_step(ref, n, dr, di, dcr, dci);
+    }
+    return static_cast<double>(max_iter);
+}
+
+// Scalar perturbation kernel: smooth iteration count of pixel
+// C + (dcr, dci) * 2^sa.exp, same bailout and smooth formula as
+// scalar_kernel() / scalar_multibrot_kernel(), or PERTURB_GLITCH. Starts at sa.skip (through the floatexp lead-in past
+// double range) and takes BLA steps wherever one is valid.
+inline double perturb_iter(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                           const BlaTable& bla, double dcr, double dci, int max_iter,
+                           double glitch_tol)
+{
+    if (sa.exp != 0) {
+        const DeepStart s = perturb_lead_in(ref, sa, dcr, dci, max_iter);
+        return perturb_from(ref, bla, std::ldexp(dcr, sa.exp), std::ldexp(dci, sa.exp),
+                            s.dr, s.di, s.n, s.i, max_iter, glitch_tol);
+    }
+    double dr, di;
+    sa.eval(dcr, dci, dr, di);
+    return perturb_from(ref, bla, dcr, dci, dr, di, sa.skip, sa.skip, max_iter, glitch_tol);
+}
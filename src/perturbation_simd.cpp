@@ -0,0 +1,433 @@
+// Perturbation (deep zoom) SIMD kernel — streams a row of pixel offsets
+// against one reference orbit (see perturbation.hpp).
+// Compiled once per ISA tier with -DSIMD_TIER=<tier> (see add_kernel_tier in
+// CMakeLists.txt); do NOT include from other translation units.
+// Double lanes only: the offsets are far below float's range.
+
+#include "simd_dispatch.hpp"
+#include "simd.hpp"
+#include "floatexp_simd.hpp"
+#include "perturbation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifndef SIMD_TIER
+#error "perturbation_simd.cpp must be built with -DSIMD_TIER=<tier>"
+#endif
+
+#define SIMD_CAT_(a, b) a##b
+#define SIMD_CAT(a, b)  SIMD_CAT_(a, b)
+
+namespace {
+
+// Passes between per-lane BLA lookups
+constexpr int BLA_CHECK_STRIDE = 8;
+
+// |a + d| - |a| per lane, as diffabs() in perturbation.hpp
+template<class V>
+typename V::vec diffabs(typename V::vec a, typename V::vec d)
+{
+    using vec = typename V::vec;
+    const vec s = V::add(a, d);
+    const vec t = V::fmadd(V::set1(2.0), a, d);
+    // a >= 0: s >= 0 ? d : -(2a + d);  a < 0: s > 0 ? 2a + d : -d
+    const vec pos = V::blend(d, V::neg(t), V::cmp_lt(s, V::zero()));
+    const vec neg = V::blend(V::neg(d), t, V::cmp_gt(s, V::zero()));
+    return V::blend(pos, neg, V::cmp_lt(a, V::zero()));
+}
+
+// Offset steps for perturb_row(), as perturb_step() in perturbation.hpp:
+// zr/zi is Z_n, sr/si Re / Im of Z_n^2 before the fold (gathered only
+// when the step folds).
+
+// z^2 with optional |Re| / |Im| folds (Celtic, Burning Ship, Buffalo) and
+// conjugation (Mandelbar); all off is plain Mandelbrot
+template<class V, bool AbsRe, bool AbsIm, bool Conj>
+struct QuadraticStep {
+    using vec = typename V::vec;
+    static constexpr bool folds = AbsRe || AbsIm;
+    int power() const { return 2; }
+
+    void operator()(vec zr, vec zi, vec sr, vec si, vec& dr, vec& di, vec dcr, vec dci) const
+    {
+        // dz' = (2Z + dz) dz + dc
+        const vec tr = V::fmadd(V::set1(2.0), zr, dr);
+        const vec ti = V::fmadd(V::set1(2.0), zi, di);
+        if constexpr (!folds && !Conj) {
+            const vec new_dr = V::add(V::fmsub(tr, dr, V::mul(ti, di)), dcr);
+            di = V::fmadd(tr, di, V::fmadd(ti, dr, dci));
+            dr = new_dr;
+        } else {
+            vec er = V::fmsub(tr, dr, V::mul(ti, di));
+            vec ei = V::fmadd(tr, di, V::mul(ti, dr));
+            if constexpr (AbsRe) er = diffabs<V>(sr, er);
+            if constexpr (AbsIm) ei = diffabs<V>(si, ei);
+            dr = V::add(er, dcr);
+            di = Conj ? V::sub(dci, ei) : V::add(ei, dci);
+        }
+    }
+};
+
+// z^p for p >= 3 (Multibrot, Mandelbar with Conj):
+// dz' = dz * sum_j w^j Z^(p-1-j) + dc, w = Z + dz
+template<class V, bool Conj>
+struct PowerStep {
+    using vec = typename V::vec;
+    static constexpr bool folds = false;
+    int p;
+    int power() const { return p; }
+
+    void operator()(vec zr, vec zi, vec, vec, vec& dr, vec& di, vec dcr, vec dci) const
+    {
+        const vec wr = V::add(zr, dr), wi = V::add(zi, di);
+        vec sr = V::set1(1.0), si = V::zero(), pr = sr, pi = si;
+        for (int k = 1; k < p; ++k) {
+            const vec new_pr = V::fmsub(pr, wr, V::mul(pi, wi));
+            pi = V::fmadd(pr, wi, V::mul(pi, wr));
+            pr = new_pr;
+            const vec new_sr = V::add(V::fmsub(sr, zr, V::mul(si, zi)), pr);
+            si = V::add(V::fmadd(sr, zi, V::mul(si, zr)), pi);
+            sr = new_sr;
+        }
+        const vec er = V::fmsub(sr, dr, V::mul(si, di));
+        const vec ei = V::fmadd(sr, di, V::mul(si, dr));
+        dr = V::add(er, dcr);
+        di = Conj ? V::sub(dci, ei) : V::add(ei, dci);
+    }
+};
+
+// Same streaming scheme as simd_stream_chunk(): a lane that escapes or
+// reaches max_iter writes its result and takes the next pixel of the row.
+// Each lane carries its own reference index, so Z_n is gathered per lane;
+// lanes reaching the end of the reference are rebased onto its start.
+// A new pixel enters at iteration sa.skip with its offset from the series
+// (or where the floatexp lead-in handed it over, when start is given) and
+// takes what BLA steps it can right away. Lanes share no index, so BLA
+// is looked up per lane in scalar: every BLA_CHECK_STRIDE passes the lane
+// state is spilled, advanced and reloaded; in between, plain vector steps
+// (Step, one of the structs above). Without a BLA table (every formula but
+// plain z^2 + c) the lookups are skipped. A lane failing the glitch test
+// retires with PERTURB_GLITCH.
+template<class V, int G, class Step>
+void perturb_row(const Step& step, const ReferenceOrbit& ref, const SeriesApprox& sa,
+                 const BlaTable& bla, const DeepStart* start, double dx0, double scale,
+                 int px, int n, double dy, int max_iter, double glitch_tol, double* out)
+{
+    using vec  = typename V::vec;
+    using mask = typename V::mask;
+    constexpr int L = V::lanes;
+
+    if (max_iter <= 0) {
+        std::fill(out, out + n, static_cast<double>(max_iter));
+        return;
+    }
+
+    const double* Zr = ref.re.data();
+    const double* Zi = ref.im.data();
+    const double* Sr = ref.sq_re.data();
+    const double* Si = ref.sq_im.data();
+    const double log_p   = std::log(static_cast<double>(step.power()));
+    const bool   use_bla = !bla.levels.empty();
+
+    // Lane -> pixel bookkeeping (scalar, touched when a lane finishes and
+    // at BLA checks): the pixel's dc and its offset, reference index and
+    // iteration count
+    int      lane_px[G][L];
+    double   lane_dc[G][L], lane_dr[G][L], lane_di[G][L], lane_idx[G][L], lane_it[G][L];
+    unsigned live[G];
+    int      next = 0;
+    // BLA steps for lane k of group g from the state in the lane arrays;
+    // false if there was none
+    auto bla_lane = [&](int g, int k) {
+        int m = static_cast<int>(lane_idx[g][k]);
+        int i = static_cast<int>(lane_it[g][k]);
+        const int i0 = i;
+        bla.advance(lane_dc[g][k], dy, max_iter, lane_dr[g][k], lane_di[g][k], m, i);
+        lane_idx[g][k] = m;
+        lane_it[g][k]  = i;
+        return i != i0;
+    };
+    auto load_lane = [&](int g, int k) {
+        lane_px[g][k] = next;
+        lane_dc[g][k] = dx0 + (px + next) * scale;
+        if (start) {
+            const DeepStart& s = start[next];
+            lane_dr[g][k]  = s.dr;
+            lane_di[g][k]  = s.di;
+            lane_idx[g][k] = s.n;
+            lane_it[g][k]  = s.i;
+        } else {
+            sa.eval(lane_dc[g][k], dy, lane_dr[g][k], lane_di[g][k]);
+            lane_idx[g][k] = lane_it[g][k] = sa.skip;
+        }
+        bla_lane(g, k);
+        ++next;
+    };
+    for (int g = 0; g < G; ++g) {
+        live[g] = 0;
+        for (int k = 0; k < L; ++k) {
+            lane_px[g][k] = -1;
+            lane_dc[g][k] = lane_dr[g][k] = lane_di[g][k] = 0.0;
+            lane_idx[g][k] = lane_it[g][k] = 0.0;
+            if (next < n) {
+                load_lane(g, k);
+                live[g] |= 1u << k;
+            }
+        }
+    }
+
+    const vec bailout = V::set1(4.0);
+    const vec one     = V::set1(1.0);
+    const vec zero_v  = V::zero();
+    const vec max_d_v = V::set1(static_cast<double>(max_iter));
+    const vec last_v  = V::set1(static_cast<double>(ref.last));
+    const vec dci     = V::set1(dy);
+    const vec tol_v   = V::set1(glitch_tol);
+
+    // dr/di: offset from the reference, idx: reference index n,
+    // iters: completed iterations of the pixel (idx restarts on rebase)
+    vec  dcr[G], dr[G], di[G], idx[G], iters[G];
+    mask active[G];
+    for (int g = 0; g < G; ++g) {
+        dcr[g]    = V::load(lane_dc[g]);
+        dr[g]     = V::load(lane_dr[g]);
+        di[g]     = V::load(lane_di[g]);
+        idx[g]    = V::load(lane_idx[g]);
+        iters[g]  = V::load(lane_it[g]);
+        active[g] = V::from_bits(live[g]);
+    }
+
+    auto retire = [&](int g, vec mag2, unsigned esc_bits, unsigned glitch_bits,
+                      unsigned done) {
+        double it_a[L], m2_a[L];
+        V::store(it_a, iters[g]);
+        V::store(m2_a, mag2);
+
+        unsigned refill = 0;
+        for (unsigned b = done; b; b &= b - 1) {
+            const int k = __builtin_ctz(b);
+            const int p = lane_px[g][k];
+            if ((esc_bits >> k) & 1u) {
+                // smooth = iters + 1 - log2(log2|z|), as in scalar_kernel()
+                const double log_zn = std::log(m2_a[k]) * 0.5;
+                const double nu     = std::log(log_zn / log_p) / log_p;
+                out[p] = std::max(0.0, it_a[k] + 1.0 - nu);
+            } else if ((glitch_bits >> k) & 1u) {
+                out[p] = PERTURB_GLITCH;
+            } else {
+                out[p] = static_cast<double>(max_iter);
+            }
+            if (next < n) {
+                load_lane(g, k);
+                refill |= 1u << k;
+            }
+        }
+
+        live[g]   = (live[g] & ~done) | refill;
+        active[g] = V::from_bits(live[g]);
+
+        const mask done_m = V::from_bits(done);
+        dcr[g]   = V::blend(dcr[g],   V::load(lane_dc[g]), done_m);
+        dr[g]    = V::blend(dr[g],    V::load(lane_dr[g]), done_m);
+        di[g]    = V::blend(di[g],    V::load(lane_di[g]), done_m);
+        idx[g]   = V::blend(idx[g],   V::load(lane_idx[g]), done_m);
+        iters[g] = V::blend(iters[g], V::load(lane_it[g]),  done_m);
+    };
+
+    // Spill live lanes, take their BLA steps, reload if any lane moved
+    auto bla_group = [&](int g) {
+        V::store(lane_dr[g],  dr[g]);
+        V::store(lane_di[g],  di[g]);
+        V::store(lane_idx[g], idx[g]);
+        V::store(lane_it[g],  iters[g]);
+        bool moved = false;
+        for (unsigned b = live[g]; b; b &= b - 1)
+            moved |= bla_lane(g, __builtin_ctz(b));
+        if (moved) {
+            dr[g]    = V::load(lane_dr[g]);
+            di[g]    = V::load(lane_di[g]);
+            idx[g]   = V::load(lane_idx[g]);
+            iters[g] = V::load(lane_it[g]);
+        }
+    };
+
+    auto any_live = [&] {
+        unsigned l = 0;
+        for (int g = 0; g < G; ++g) l |= live[g];
+        return l != 0;
+    };
+
+    int pass = 0;
+    while (any_live()) {
+        if (use_bla && ++pass == BLA_CHECK_STRIDE) {
+            pass = 0;
+            for (int g = 0; g < G; ++g)
+                if (live[g]) bla_group(g);
+        }
+
+        unsigned esc_bits[G], glitch_bits[G], done[G];
+        vec      mag2[G];
+
+        for (int g = 0; g < G; ++g) {
+            // Groups drained at the tail of the row are skipped outright
+            done[g] = 0;
+            if (!live[g]) continue;
+
+            vec ref_r = V::gather(Zr, idx[g]);
+            vec ref_i = V::gather(Zi, idx[g]);
+            const vec zr = V::add(ref_r, dr[g]);
+            const vec zi = V::add(ref_i, di[g]);
+            mag2[g] = V::fmadd(zr, zr, V::mul(zi, zi));
+
+            // Rebase every lane (idle ones too, so idx stays in range) that
+            // has reached the end of the reference: dz = z, n = 0, Z_0 = 0.
+            // Any other lane with |z| far below |Z| is a glitch.
+            const mask reb      = V::cmp_ge(idx[g], last_v);
+            const mask just_esc = V::mask_and(V::cmp_gt(mag2[g], bailout), active[g]);
+            const vec  ref_mag2 = V::fmadd(ref_r, ref_r, V::mul(ref_i, ref_i));
+            const mask glitch   = V::mask_andnot(reb, V::mask_andnot(just_esc,
+                                      V::mask_and(V::cmp_lt(mag2[g], V::mul(tol_v, ref_mag2)),
+                                                  active[g])));
+            const mask cont     = V::mask_andnot(glitch, V::mask_andnot(just_esc, active[g]));
+
+            if (V::any(reb)) {
+                dr[g]  = V::blend(dr[g],  zr,     reb);
+                di[g]  = V::blend(di[g],  zi,     reb);
+                idx[g] = V::blend(idx[g], zero_v, reb);
+                ref_r  = V::blend(ref_r,  zero_v, reb);
+                ref_i  = V::blend(ref_i,  zero_v, reb);
+            }
+
+            vec sq_r = zero_v, sq_i = zero_v;
+            if constexpr (Step::folds) {
+                sq_r = V::gather(Sr, idx[g]);
+                sq_i = V::gather(Si, idx[g]);
+            }
+            step(ref_r, ref_i, sq_r, sq_i, dr[g], di[g], dcr[g], dci);
+            idx[g]   = V::add(idx[g], one);
+            iters[g] = V::add_masked(iters[g], cont, one);
+
+            const mask maxed = V::mask_and(V::cmp_ge(iters[g], max_d_v), cont);
+            esc_bits[g]    = V::bits(just_esc);
+            glitch_bits[g] = V::bits(glitch);
+            done[g]        = esc_bits[g] | glitch_bits[g] | V::bits(maxed);
+        }
+
+        for (int g = 0; g < G; ++g)
+            if (done[g]) retire(g, mag2[g], esc_bits[g], glitch_bits[g], done[g]);
+    }
+}
+
+// Floatexp lead-in (see perturb_lead_in()): blocks of L pixels iterate in
+// lockstep, since every lane starts at sa.skip and none can escape before
+// hand-over, so Z_n is a broadcast. A lane is handed over (written to
+// start[]) as soon as its offset is back in double range; the block stops
+// once all of them are, or at the end of the reference or one short of
+// max_iter.
+template<class V>
+void lead_in_row(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                 double dx0, double scale, int px, int n, double dy,
+                 int max_iter, DeepStart* start)
+{
+    using vec = typename V::vec;
+    using FE  = FloatExpV<V>;
+    constexpr int L = V::lanes;
+
+    const double* Zr = ref.re.data();
+    const double* Zi = ref.im.data();
+    const int  stop    = std::min(ref.last, max_iter - 1);
+    const vec  exp_v   = V::set1(static_cast<double>(sa.exp));
+    const vec  handoff = V::set1(static_cast<double>(FLOATEXP_HANDOFF_EXP));
+    const FE   ci      = FE::make(V::set1(dy), exp_v);
+
+    for (int b = 0; b < n; b += L) {
+        const int cnt = std::min(L, n - b);
+
+        // Series values per lane (a short tail repeats its last pixel)
+        double cr_a[L], dr_a[L], di_a[L];
+        for (int k = 0; k < L; ++k) {
+            cr_a[k] = dx0 + (px + b + std::min(k, cnt - 1)) * scale;
+            sa.eval(cr_a[k], dy, dr_a[k], di_a[k]);
+        }
+        const FE cr = FE::make(V::load(cr_a), exp_v);
+        FE       dr = FE::make(V::load(dr_a), exp_v);
+        FE       di = FE::make(V::load(di_a), exp_v);
+
+        unsigned pending = (1u << cnt) - 1;
+        for (int m = sa.skip;; ++m) {
+            unsigned ready = pending;
+            if (m < stop)
+                ready &= V::bits(V::cmp_ge(V::max(dr.e, di.e), handoff));
+            if (ready) {
+                V::store(dr_a, dr.to_double());
+                V::store(di_a, di.to_double());
+                for (unsigned r = ready; r; r &= r - 1) {
+                    const int k = __builtin_ctz(r);
+                    start[b + k] = { dr_a[k], di_a[k], m, m };
+                }
+                pending &= ~ready;
+                if (!pending) break;
+            }
+
+            // dz' = (2Z + dz) dz + dc
+            const FE tr = FE::add(FE::from(V::set1(2.0 * Zr[m])), dr);
+            const FE ti = FE::add(FE::from(V::set1(2.0 * Zi[m])), di);
+            const FE new_dr = FE::add(FE::sub(FE::mul(tr, dr), FE::mul(ti, di)), cr);
+            di = FE::add(FE::add(FE::mul(tr, di), FE::mul(ti, dr)), ci);
+            dr = new_dr;
+        }
+    }
+}
+
+template<class V, int G, bool AbsRe, bool AbsIm, bool Conj>
+void quadratic_row(const ReferenceOrbit& ref, const SeriesApprox& sa, const BlaTable& bla,
+                   const DeepStart* start, double dx0, double scale, int px, int n, double dy,
+                   int max_iter, double glitch_tol, double* out)
+{
+    perturb_row<V, G>(QuadraticStep<V, AbsRe, AbsIm, Conj>{}, ref, sa, bla, start,
+                      dx0, scale, px, n, dy, max_iter, glitch_tol, out);
+}
+
+template<class V, int G, bool Conj>
+void power_row(const ReferenceOrbit& ref, const SeriesApprox& sa, const BlaTable& bla,
+               const DeepStart* start, double dx0, double scale, int px, int n, double dy,
+               int max_iter, int exp_n, double glitch_tol, double* out)
+{
+    perturb_row<V, G>(PowerStep<V, Conj>{exp_n}, ref, sa, bla, start,
+                      dx0, scale, px, n, dy, max_iter, glitch_tol, out);
+}
+
+template<class V, int G>
+const PerturbationKernels& table()
+{
+    static const PerturbationKernels t = {
+        V::lanes,
+        G,
+        quadratic_row<V, G, false, false, false>,
+        lead_in_row<V>,
+        quadratic_row<V, G, false, true,  false>,
+        quadratic_row<V, G, false, false, true>,
+        power_row<V, G, true>,
+        power_row<V, G, false>,
+        quadratic_row<V, G, true,  false, false>,
+        quadratic_row<V, G, true,  true,  false>,
+    };
+    return t;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------
+// Exported table — perturbation_kernels_<tier>(interleave)
+// -----------------------------------------------------------------------
+
+const PerturbationKernels& SIMD_CAT(perturbation_kernels_, SIMD_TIER)(int interleave)
+{
+    switch (interleave) {
+        case 1:  return table<SimdTierV, 1>();
+        case 2:  return table<SimdTierV, 2>();
+        case 3:  return table<SimdTierV, 3>();
+        default: return table<SimdTierV, 4>();
+    }
+}
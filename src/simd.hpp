@@ -0,0 +1,585 @@
+#pragma once
+
+// Per-ISA SIMD lane wrappers used by the kernel translation units.
+// Kernel bodies are written once against this interface; each kernel .cpp is
+// compiled once per tier (see CMakeLists.txt) and SimdTierV below picks the
+// widest wrapper the current -m flags allow.
+//
+// Only include from a translation unit compiled with the matching -m flags.
+// Everything sits in an anonymous namespace so every TU gets its own copy
+// built for its own ISA — the linker must never fold an AVX-512 body into
+// the AVX path.
+//
+// Masks: SSE2/AVX use all-ones lanes, AVX-512 uses __mmask8/__mmask16.
+// V::scalar is the lane type (double, or float for the *F wrappers).
+// blend(a, b, m) picks b where m is set (same argument order as blendv);
+// masked(a, m) keeps a where m is set and zeroes the other lanes.
+// bits(m) / from_bits(b) convert to and from a lane bitmask (bit k = lane k).
+// fmadd/fmsub/fnmadd fuse only when the build has FMA; otherwise they are
+// exactly mul followed by add/sub. V::fused says which (double wrappers).
+// gather(base, idx) loads base[idx[k]] into lane k, idx holding small
+// non-negative integers as doubles (double wrappers only).
+// frexp(a, e) / ldexp(a, k) work like the <cmath> functions with integer
+// exponents held as lane values (ldexp: double wrappers only): frexp is
+// meant for normal or zero a (its result for 0 is unspecified), ldexp takes
+// any k and over- or underflows like the exact result would.
+
+#include <immintrin.h>
+#include <sleef.h>
+#include <cstdint>
+
+namespace {
+
+#if defined(__SSE2__)
+struct SimdSse2 {
+    static constexpr int  lanes = 2;
+    static constexpr bool fused = false;
+    using scalar = double;
+    using vec  = __m128d;
+    using mask = __m128d;
+
+    static vec  set1(double x)             { return _mm_set1_pd(x); }
+    static vec  zero()                     { return _mm_setzero_pd(); }
+    static vec  load(const double* p)      { return _mm_loadu_pd(p); }
+    static void store(double* p, vec a)    { _mm_storeu_pd(p, a); }
+
+    static vec gather(const double* base, vec idx)
+    {
+        const __m128i i = _mm_cvttpd_epi32(idx);
+        return _mm_set_pd(base[_mm_cvtsi128_si32(_mm_srli_si128(i, 4))],
+                          base[_mm_cvtsi128_si32(i)]);
+    }
+
+    // base + k*step for lane k
+    static vec ramp(double base, double step)
+    {
+        return _mm_set_pd(base + step, base);
+    }
+
+    static vec add(vec a, vec b) { return _mm_add_pd(a, b); }
+    static vec sub(vec a, vec b) { return _mm_sub_pd(a, b); }
+    static vec mul(vec a, vec b) { return _mm_mul_pd(a, b); }
+    static vec div(vec a, vec b) { return _mm_div_pd(a, b); }
+    static vec sqrt(vec a)       { return _mm_sqrt_pd(a); }
+    static vec min(vec a, vec b) { return _mm_min_pd(a, b); }
+    static vec max(vec a, vec b) { return _mm_max_pd(a, b); }
+    static vec abs(vec a)        { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static vec neg(vec a)        { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+
+    // Biased exponent field <-> integer-valued double via the 2^52 trick
+    static vec frexp(vec a, vec& e)
+    {
+        const __m128i bits = _mm_castpd_si128(a);
+        const __m128i bexp = _mm_srli_epi64(_mm_and_si128(bits, _mm_set1_epi64x(0x7FF0000000000000LL)), 52);
+        e = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(bexp, _mm_set1_epi64x(0x4330000000000000LL))),
+                       _mm_set1_pd(0x1p52 + 1022.0));
+        return _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(0x800FFFFFFFFFFFFFLL)),
+                                             _mm_set1_epi64x(0x3FE0000000000000LL)));
+    }
+    // 2^k for integer k in [-1022, 1023]
+    static vec pow2(vec k)
+    {
+        const __m128i b = _mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(0x1p52 + 1023.0)));
+        return _mm_castsi128_pd(_mm_slli_epi64(b, 52));
+    }
+    static vec ldexp(vec a, vec k)
+    {
+        k = _mm_min_pd(_mm_max_pd(k, _mm_set1_pd(-2044.0)), _mm_set1_pd(2046.0));
+        const vec k1 = _mm_min_pd(_mm_max_pd(k, _mm_set1_pd(-1022.0)), _mm_set1_pd(1023.0));
+        return _mm_mul_pd(_mm_mul_pd(a, pow2(k1)), pow2(_mm_sub_pd(k, k1)));
+    }
+
+    static vec fmadd(vec a, vec b, vec c)  { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm_sub_pd(_mm_mul_pd(a, b), c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm_sub_pd(c, _mm_mul_pd(a, b)); }
+
+    static mask all()                     { return _mm_castsi128_pd(_mm_set1_epi64x(-1LL)); }
+    static mask cmp_gt(vec a, vec b)      { return _mm_cmpgt_pd(a, b); }
+    static mask cmp_lt(vec a, vec b)      { return _mm_cmplt_pd(a, b); }
+    static mask cmp_ge(vec a, vec b)      { return _mm_cmpge_pd(a, b); }
+    static mask mask_and(mask a, mask b)  { return _mm_and_pd(a, b); }
+    static mask mask_or( mask a, mask b)  { return _mm_or_pd(a, b); }
+    static mask mask_andnot(mask a, mask b) { return _mm_andnot_pd(a, b); }  // ~a & b
+    static bool any(mask m)               { return _mm_movemask_pd(m) != 0; }
+    static unsigned bits(mask m)          { return static_cast<unsigned>(_mm_movemask_pd(m)); }
+    static mask from_bits(unsigned b)
+    {
+        return _mm_castsi128_pd(_mm_set_epi64x(-static_cast<long long>((b >> 1) & 1),
+                                               -static_cast<long long>( b       & 1)));
+    }
+
+    // SSE2 has no blendv — select with and/andnot/or
+    static vec blend(vec a, vec b, mask m)      { return _mm_or_pd(_mm_and_pd(m, b), _mm_andnot_pd(m, a)); }
+    static vec masked(vec a, mask m)            { return _mm_and_pd(a, m); }
+    static vec add_masked(vec a, mask m, vec b) { return _mm_add_pd(a, _mm_and_pd(m, b)); }
+
+    static vec log(vec a)          { return Sleef_logd2_u35(a); }
+    static vec exp(vec a)          { return Sleef_expd2_u10(a); }
+    static vec atan2(vec y, vec x) { return Sleef_atan2d2_u10(y, x); }
+    static void sincos(vec a, vec& s, vec& c)
+    {
+        Sleef___m128d_2 sc = Sleef_sincosd2_u10(a);
+        s = sc.x;
+        c = sc.y;
+    }
+};
+#endif
+
+#if defined(__AVX__)
+struct SimdAvx {
+    static constexpr int lanes = 4;
+#if defined(__FMA__)
+    static constexpr bool fused = true;
+#else
+    static constexpr bool fused = false;
+#endif
+    using scalar = double;
+    using vec  = __m256d;
+    using mask = __m256d;
+
+    static vec  set1(double x)             { return _mm256_set1_pd(x); }
+    static vec  zero()                     { return _mm256_setzero_pd(); }
+    static vec  load(const double* p)      { return _mm256_loadu_pd(p); }
+    static void store(double* p, vec a)    { _mm256_storeu_pd(p, a); }
+
+    static vec gather(const double* base, vec idx)
+    {
+        const __m128i i = _mm256_cvttpd_epi32(idx);
+#if defined(__AVX2__)
+        return _mm256_i32gather_pd(base, i, 8);
+#else
+        alignas(16) int k[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(k), i);
+        return _mm256_set_pd(base[k[3]], base[k[2]], base[k[1]], base[k[0]]);
+#endif
+    }
+
+    // base + k*step for lane k
+    static vec ramp(double base, double step)
+    {
+        return _mm256_set_pd(base + 3.0*step, base + 2.0*step,
+                             base +     step,  base);
+    }
+
+    static vec add(vec a, vec b) { return _mm256_add_pd(a, b); }
+    static vec sub(vec a, vec b) { return _mm256_sub_pd(a, b); }
+    static vec mul(vec a, vec b) { return _mm256_mul_pd(a, b); }
+    static vec div(vec a, vec b) { return _mm256_div_pd(a, b); }
+    static vec sqrt(vec a)       { return _mm256_sqrt_pd(a); }
+    static vec min(vec a, vec b) { return _mm256_min_pd(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_pd(a, b); }
+    static vec abs(vec a)        { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static vec neg(vec a)        { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+
+    // As SimdSse2::frexp/pow2; plain AVX has no 256-bit integer ops, so
+    // the bit work runs on the two 128-bit halves
+#if defined(__AVX2__)
+    static __m256i and_bits(__m256i a, long long m) { return _mm256_and_si256(a, _mm256_set1_epi64x(m)); }
+    static __m256i or_bits(__m256i a, long long m)  { return _mm256_or_si256(a, _mm256_set1_epi64x(m)); }
+    static __m256i srl52(__m256i a)                 { return _mm256_srli_epi64(a, 52); }
+    static __m256i sll52(__m256i a)                 { return _mm256_slli_epi64(a, 52); }
+#else
+    template<class F>
+    static __m256i halves(__m256i a, F f)
+    {
+        return _mm256_setr_m128i(f(_mm256_castsi256_si128(a)), f(_mm256_extractf128_si256(a, 1)));
+    }
+    static __m256i and_bits(__m256i a, long long m)
+    {
+        return halves(a, [m](__m128i h) { return _mm_and_si128(h, _mm_set1_epi64x(m)); });
+    }
+    static __m256i or_bits(__m256i a, long long m)
+    {
+        return halves(a, [m](__m128i h) { return _mm_or_si128(h, _mm_set1_epi64x(m)); });
+    }
+    static __m256i srl52(__m256i a) { return halves(a, [](__m128i h) { return _mm_srli_epi64(h, 52); }); }
+    static __m256i sll52(__m256i a) { return halves(a, [](__m128i h) { return _mm_slli_epi64(h, 52); }); }
+#endif
+    static vec frexp(vec a, vec& e)
+    {
+        const __m256i bits = _mm256_castpd_si256(a);
+        const __m256i bexp = srl52(and_bits(bits, 0x7FF0000000000000LL));
+        e = _mm256_sub_pd(_mm256_castsi256_pd(or_bits(bexp, 0x4330000000000000LL)),
+                          _mm256_set1_pd(0x1p52 + 1022.0));
+        return _mm256_castsi256_pd(or_bits(and_bits(bits, 0x800FFFFFFFFFFFFFLL), 0x3FE0000000000000LL));
+    }
+    static vec pow2(vec k)
+    {
+        return _mm256_castsi256_pd(sll52(_mm256_castpd_si256(
+            _mm256_add_pd(k, _mm256_set1_pd(0x1p52 + 1023.0)))));
+    }
+    static vec ldexp(vec a, vec k)
+    {
+        k = _mm256_min_pd(_mm256_max_pd(k, _mm256_set1_pd(-2044.0)), _mm256_set1_pd(2046.0));
+        const vec k1 = _mm256_min_pd(_mm256_max_pd(k, _mm256_set1_pd(-1022.0)), _mm256_set1_pd(1023.0));
+        return _mm256_mul_pd(_mm256_mul_pd(a, pow2(k1)), pow2(_mm256_sub_pd(k, k1)));
+    }
+
+#if defined(__FMA__)
+    static vec fmadd(vec a, vec b, vec c)  { return _mm256_fmadd_pd(a, b, c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm256_fmsub_pd(a, b, c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm256_fnmadd_pd(a, b, c); }
+#else
+    static vec fmadd(vec a, vec b, vec c)  { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm256_sub_pd(_mm256_mul_pd(a, b), c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm256_sub_pd(c, _mm256_mul_pd(a, b)); }
+#endif
+
+    static mask all()                     { return _mm256_castsi256_pd(_mm256_set1_epi64x(-1LL)); }
+    static mask cmp_gt(vec a, vec b)      { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static mask cmp_lt(vec a, vec b)      { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static mask cmp_ge(vec a, vec b)      { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static mask mask_and(mask a, mask b)  { return _mm256_and_pd(a, b); }
+    static mask mask_or( mask a, mask b)  { return _mm256_or_pd(a, b); }
+    static mask mask_andnot(mask a, mask b) { return _mm256_andnot_pd(a, b); }  // ~a & b
+    static bool any(mask m)               { return _mm256_movemask_pd(m) != 0; }
+    static unsigned bits(mask m)          { return static_cast<unsigned>(_mm256_movemask_pd(m)); }
+    static mask from_bits(unsigned b)
+    {
+        return _mm256_castsi256_pd(_mm256_set_epi64x(-static_cast<long long>((b >> 3) & 1),
+                                                     -static_cast<long long>((b >> 2) & 1),
+                                                     -static_cast<long long>((b >> 1) & 1),
+                                                     -static_cast<long long>( b       & 1)));
+    }
+
+    static vec blend(vec a, vec b, mask m)      { return _mm256_blendv_pd(a, b, m); }
+    static vec masked(vec a, mask m)            { return _mm256_and_pd(a, m); }
+    static vec add_masked(vec a, mask m, vec b) { return _mm256_add_pd(a, _mm256_and_pd(m, b)); }
+
+    static vec log(vec a)          { return Sleef_logd4_u35(a); }
+    static vec exp(vec a)          { return Sleef_expd4_u10(a); }
+    static vec atan2(vec y, vec x) { return Sleef_atan2d4_u10(y, x); }
+    static void sincos(vec a, vec& s, vec& c)
+    {
+        Sleef___m256d_2 sc = Sleef_sincosd4_u10(a);
+        s = sc.x;
+        c = sc.y;
+    }
+};
+#endif
+
+#if defined(__AVX512F__)
+struct SimdAvx512 {
+    static constexpr int  lanes = 8;
+    static constexpr bool fused = true;
+    using scalar = double;
+    using vec  = __m512d;
+    using mask = __mmask8;
+
+    static vec  set1(double x)             { return _mm512_set1_pd(x); }
+    static vec  zero()                     { return _mm512_setzero_pd(); }
+    static vec  load(const double* p)      { return _mm512_loadu_pd(p); }
+    static void store(double* p, vec a)    { _mm512_storeu_pd(p, a); }
+
+    static vec gather(const double* base, vec idx)
+    {
+        return _mm512_i32gather_pd(_mm512_cvttpd_epi32(idx), base, 8);
+    }
+
+    static vec ramp(double base, double step)
+    {
+        return _mm512_set_pd(base + 7.0*step, base + 6.0*step,
+                             base + 5.0*step, base + 4.0*step,
+                             base + 3.0*step, base + 2.0*step,
+                             base +     step,  base);
+    }
+
+    static vec add(vec a, vec b) { return _mm512_add_pd(a, b); }
+    static vec sub(vec a, vec b) { return _mm512_sub_pd(a, b); }
+    static vec mul(vec a, vec b) { return _mm512_mul_pd(a, b); }
+    static vec div(vec a, vec b) { return _mm512_div_pd(a, b); }
+    static vec sqrt(vec a)       { return _mm512_sqrt_pd(a); }
+    static vec min(vec a, vec b) { return _mm512_min_pd(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_pd(a, b); }
+    static vec abs(vec a)        { return _mm512_abs_pd(a); }
+    static vec neg(vec a)
+    {
+        return _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(a),
+                                                     _mm512_set1_epi64(INT64_MIN)));
+    }
+
+    // getexp is floor(log2|a|), one below frexp's exponent
+    static vec frexp(vec a, vec& e)
+    {
+        e = _mm512_add_pd(_mm512_getexp_pd(a), _mm512_set1_pd(1.0));
+        return _mm512_getmant_pd(a, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    }
+    static vec ldexp(vec a, vec k) { return _mm512_scalef_pd(a, k); }
+
+    static vec fmadd(vec a, vec b, vec c)  { return _mm512_fmadd_pd(a, b, c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm512_fmsub_pd(a, b, c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm512_fnmadd_pd(a, b, c); }
+
+    static mask all()                     { return static_cast<mask>(0xFF); }
+    static mask cmp_gt(vec a, vec b)      { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static mask cmp_lt(vec a, vec b)      { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static mask cmp_ge(vec a, vec b)      { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+    static mask mask_and(mask a, mask b)  { return static_cast<mask>(a & b); }
+    static mask mask_or( mask a, mask b)  { return static_cast<mask>(a | b); }
+    static mask mask_andnot(mask a, mask b) { return static_cast<mask>(~a & b); }
+    static bool any(mask m)               { return m != 0; }
+    static unsigned bits(mask m)          { return m; }
+    static mask from_bits(unsigned b)     { return static_cast<mask>(b); }
+
+    static vec blend(vec a, vec b, mask m)      { return _mm512_mask_blend_pd(m, a, b); }
+    static vec masked(vec a, mask m)            { return _mm512_maskz_mov_pd(m, a); }
+    static vec add_masked(vec a, mask m, vec b) { return _mm512_mask_add_pd(a, m, a, b); }
+
+    static vec log(vec a)          { return Sleef_logd8_u35(a); }
+    static vec exp(vec a)          { return Sleef_expd8_u10(a); }
+    static vec atan2(vec y, vec x) { return Sleef_atan2d8_u10(y, x); }
+    static void sincos(vec a, vec& s, vec& c)
+    {
+        Sleef___m512d_2 sc = Sleef_sincosd8_u10(a);
+        s = sc.x;
+        c = sc.y;
+    }
+};
+#endif
+
+// -----------------------------------------------------------------------
+// Single-precision wrappers — twice the lanes per register. Same interface
+// as the double wrappers (set1 takes a double and rounds it to float).
+// -----------------------------------------------------------------------
+
+#if defined(__SSE2__)
+struct SimdSse2F {
+    static constexpr int lanes = 4;
+    using scalar = float;
+    using vec  = __m128;
+    using mask = __m128;
+
+    static vec  set1(double x)             { return _mm_set1_ps(static_cast<float>(x)); }
+    static vec  zero()                     { return _mm_setzero_ps(); }
+    static vec  load(const float* p)       { return _mm_loadu_ps(p); }
+    static void store(float* p, vec a)     { _mm_storeu_ps(p, a); }
+
+    // base + k*step for lane k (computed in double, then rounded)
+    static vec ramp(double base, double step)
+    {
+        return _mm_set_ps(static_cast<float>(base + 3.0*step), static_cast<float>(base + 2.0*step),
+                          static_cast<float>(base +     step), static_cast<float>(base));
+    }
+
+    static vec add(vec a, vec b) { return _mm_add_ps(a, b); }
+    static vec sub(vec a, vec b) { return _mm_sub_ps(a, b); }
+    static vec mul(vec a, vec b) { return _mm_mul_ps(a, b); }
+    static vec div(vec a, vec b) { return _mm_div_ps(a, b); }
+    static vec sqrt(vec a)       { return _mm_sqrt_ps(a); }
+    static vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+    static vec abs(vec a)        { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static vec neg(vec a)        { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+
+    // As SimdSse2::frexp, float's 8-bit exponent field converted directly
+    static vec frexp(vec a, vec& e)
+    {
+        const __m128i bits = _mm_castps_si128(a);
+        e = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7F800000)), 23)),
+                       _mm_set1_ps(126.0f));
+        return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x807FFFFFu))),
+                                             _mm_set1_epi32(0x3F000000)));
+    }
+
+    static vec fmadd(vec a, vec b, vec c)  { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm_sub_ps(_mm_mul_ps(a, b), c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm_sub_ps(c, _mm_mul_ps(a, b)); }
+
+    static mask all()                     { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+    static mask cmp_gt(vec a, vec b)      { return _mm_cmpgt_ps(a, b); }
+    static mask cmp_lt(vec a, vec b)      { return _mm_cmplt_ps(a, b); }
+    static mask cmp_ge(vec a, vec b)      { return _mm_cmpge_ps(a, b); }
+    static mask mask_and(mask a, mask b)  { return _mm_and_ps(a, b); }
+    static mask mask_or( mask a, mask b)  { return _mm_or_ps(a, b); }
+    static mask mask_andnot(mask a, mask b) { return _mm_andnot_ps(a, b); }  // ~a & b
+    static bool any(mask m)               { return _mm_movemask_ps(m) != 0; }
+    static unsigned bits(mask m)          { return static_cast<unsigned>(_mm_movemask_ps(m)); }
+    static mask from_bits(unsigned b)
+    {
+        return _mm_castsi128_ps(_mm_set_epi32(-static_cast<int>((b >> 3) & 1),
+                                              -static_cast<int>((b >> 2) & 1),
+                                              -static_cast<int>((b >> 1) & 1),
+                                              -static_cast<int>( b       & 1)));
+    }
+
+    static vec blend(vec a, vec b, mask m)      { return _mm_or_ps(_mm_and_ps(m, b), _mm_andnot_ps(m, a)); }
+    static vec masked(vec a, mask m)            { return _mm_and_ps(a, m); }
+    static vec add_masked(vec a, mask m, vec b) { return _mm_add_ps(a, _mm_and_ps(m, b)); }
+
+    static vec log(vec a)          { return Sleef_logf4_u35(a); }
+    static vec exp(vec a)          { return Sleef_expf4_u10(a); }
+    static vec atan2(vec y, vec x) { return Sleef_atan2f4_u10(y, x); }
+    static void sincos(vec a, vec& s, vec& c)
+    {
+        Sleef___m128_2 sc = Sleef_sincosf4_u10(a);
+        s = sc.x;
+        c = sc.y;
+    }
+};
+#endif
+
+#if defined(__AVX__)
+struct SimdAvxF {
+    static constexpr int lanes = 8;
+    using scalar = float;
+    using vec  = __m256;
+    using mask = __m256;
+
+    static vec  set1(double x)             { return _mm256_set1_ps(static_cast<float>(x)); }
+    static vec  zero()                     { return _mm256_setzero_ps(); }
+    static vec  load(const float* p)       { return _mm256_loadu_ps(p); }
+    static void store(float* p, vec a)     { _mm256_storeu_ps(p, a); }
+
+    static vec ramp(double base, double step)
+    {
+        float r[8];
+        for (int k = 0; k < 8; ++k) r[k] = static_cast<float>(base + k * step);
+        return _mm256_loadu_ps(r);
+    }
+
+    static vec add(vec a, vec b) { return _mm256_add_ps(a, b); }
+    static vec sub(vec a, vec b) { return _mm256_sub_ps(a, b); }
+    static vec mul(vec a, vec b) { return _mm256_mul_ps(a, b); }
+    static vec div(vec a, vec b) { return _mm256_div_ps(a, b); }
+    static vec sqrt(vec a)       { return _mm256_sqrt_ps(a); }
+    static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+    static vec abs(vec a)        { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static vec neg(vec a)        { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+
+    // As SimdSse2F::frexp without 256-bit integer shifts: the masked
+    // exponent field read as an integer is e * 2^23, exact in float
+    static vec frexp(vec a, vec& e)
+    {
+        const vec field = _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)));
+        e = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(field)), _mm256_set1_ps(0x1p-23f)),
+                          _mm256_set1_ps(126.0f));
+        return _mm256_or_ps(_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x807FFFFFu)))),
+                            _mm256_set1_ps(0.5f));
+    }
+
+#if defined(__FMA__)
+    static vec fmadd(vec a, vec b, vec c)  { return _mm256_fmadd_ps(a, b, c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm256_fmsub_ps(a, b, c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm256_fnmadd_ps(a, b, c); }
+#else
+    static vec fmadd(vec a, vec b, vec c)  { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm256_sub_ps(_mm256_mul_ps(a, b), c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm256_sub_ps(c, _mm256_mul_ps(a, b)); }
+#endif
+
+    static mask all()                     { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+    static mask cmp_gt(vec a, vec b)      { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static mask cmp_lt(vec a, vec b)      { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static mask cmp_ge(vec a, vec b)      { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static mask mask_and(mask a, mask b)  { return _mm256_and_ps(a, b); }
+    static mask mask_or( mask a, mask b)  { return _mm256_or_ps(a, b); }
+    static mask mask_andnot(mask a, mask b) { return _mm256_andnot_ps(a, b); }  // ~a & b
+    static bool any(mask m)               { return _mm256_movemask_ps(m) != 0; }
+    static unsigned bits(mask m)          { return static_cast<unsigned>(_mm256_movemask_ps(m)); }
+    static mask from_bits(unsigned b)
+    {
+        int m[8];
+        for (int k = 0; k < 8; ++k) m[k] = -static_cast<int>((b >> k) & 1);
+        return _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(m)));
+    }
+
+    static vec blend(vec a, vec b, mask m)      { return _mm256_blendv_ps(a, b, m); }
+    static vec masked(vec a, mask m)            { return _mm256_and_ps(a, m); }
+    static vec add_masked(vec a, mask m, vec b) { return _mm256_add_ps(a, _mm256_and_ps(m, b)); }
+
+    static vec log(vec a)          { return Sleef_logf8_u35(a); }
+    static vec exp(vec a)          { return Sleef_expf8_u10(a); }
+    static vec atan2(vec y, vec x) { return Sleef_atan2f8_u10(y, x); }
+    static void sincos(vec a, vec& s, vec& c)
+    {
+        Sleef___m256_2 sc = Sleef_sincosf8_u10(a);
+        s = sc.x;
+        c = sc.y;
+    }
+};
+#endif
+
+#if defined(__AVX512F__)
+struct SimdAvx512F {
+    static constexpr int lanes = 16;
+    using scalar = float;
+    using vec  = __m512;
+    using mask = __mmask16;
+
+    static vec  set1(double x)             { return _mm512_set1_ps(static_cast<float>(x)); }
+    static vec  zero()                     { return _mm512_setzero_ps(); }
+    static vec  load(const float* p)       { return _mm512_loadu_ps(p); }
+    static void store(float* p, vec a)     { _mm512_storeu_ps(p, a); }
+
+    static vec ramp(double base, double step)
+    {
+        float r[16];
+        for (int k = 0; k < 16; ++k) r[k] = static_cast<float>(base + k * step);
+        return _mm512_loadu_ps(r);
+    }
+
+    static vec add(vec a, vec b) { return _mm512_add_ps(a, b); }
+    static vec sub(vec a, vec b) { return _mm512_sub_ps(a, b); }
+    static vec mul(vec a, vec b) { return _mm512_mul_ps(a, b); }
+    static vec div(vec a, vec b) { return _mm512_div_ps(a, b); }
+    static vec sqrt(vec a)       { return _mm512_sqrt_ps(a); }
+    static vec min(vec a, vec b) { return _mm512_min_ps(a, b); }
+    static vec max(vec a, vec b) { return _mm512_max_ps(a, b); }
+    static vec abs(vec a)        { return _mm512_abs_ps(a); }
+    static vec neg(vec a)
+    {
+        return _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(a),
+                                                     _mm512_set1_epi32(INT32_MIN)));
+    }
+
+    static vec frexp(vec a, vec& e)
+    {
+        e = _mm512_add_ps(_mm512_getexp_ps(a), _mm512_set1_ps(1.0f));
+        return _mm512_getmant_ps(a, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    }
+
+    static vec fmadd(vec a, vec b, vec c)  { return _mm512_fmadd_ps(a, b, c); }
+    static vec fmsub(vec a, vec b, vec c)  { return _mm512_fmsub_ps(a, b, c); }
+    static vec fnmadd(vec a, vec b, vec c) { return _mm512_fnmadd_ps(a, b, c); }
+
+    static mask all()                     { return static_cast<mask>(0xFFFF); }
+    static mask cmp_gt(vec a, vec b)      { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static mask cmp_lt(vec a, vec b)      { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static mask cmp_ge(vec a, vec b)      { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static mask mask_and(mask a, mask b)  { return static_cast<mask>(a & b); }
+    static mask mask_or( mask a, mask b)  { return static_cast<mask>(a | b); }
+    static mask mask_andnot(mask a, mask b) { return static_cast<mask>(~a & b); }
+    static bool any(mask m)               { return m != 0; }
+    static unsigned bits(mask m)          { return m; }
+    static mask from_bits(unsigned b)     { return static_cast<mask>(b); }
+
+    static vec blend(vec a, vec b, mask m)      { return _mm512_mask_blend_ps(m, a, b); }
+    static vec masked(vec a, mask m)            { return _mm512_maskz_mov_ps(m, a); }
+    static vec add_masked(vec a, mask m, vec b) { return _mm512_mask_add_ps(a, m, a, b); }
+
+    static vec log(vec a)          { return Sleef_logf16_u35(a); }
+    static vec exp(vec a)          { return Sleef_expf16_u10(a); }
+    static vec atan2(vec y, vec x) { return Sleef_atan2f16_u10(y, x); }
+    static void sincos(vec a, vec& s, vec& c)
+    {
+        Sleef___m512_2 sc = Sleef_sincosf16_u10(a);
+        s = sc.x;
+        c = sc.y;
+    }
+};
+#endif
+
+// Widest wrappers available to this translation unit (double / float)
+#if defined(__AVX512F__)
+using SimdTierV  = SimdAvx512;
+using SimdTierVF = SimdAvx512F;
+#elif defined(__AVX__)
+using SimdTierV  = SimdAvx;
+using SimdTierVF = SimdAvxF;
+#else
+using SimdTierV  = SimdSse2;
+using SimdTierVF = SimdSse2F;
+#endif
+
+} // namespace
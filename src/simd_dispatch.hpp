@@ -0,0 +1,227 @@
+#pragma once
+
+#include "view_state.hpp"   // FormulaType
+
+#include <array>
+
+// Runtime SIMD dispatch tables.
+//
+// escape_time_simd.cpp, newton_simd.cpp and perturbation_simd.cpp are
+// compiled once per ISA tier (see add_kernel_tier in CMakeLists.txt). Each
+// build exports one table of function pointers; CpuRenderer picks the
+// widest table the CPU supports at startup via CPUID and calls through it.
+// Nothing outside the tier objects is compiled with -m flags, so the binary
+// still starts on any x86-64 CPU.
+
+enum class SimdTier { Scalar = 0, Sse2, Avx, Avx2Fma, Avx512 };
+
+inline const char* simd_tier_name(SimdTier t)
+{
+    switch (t) {
+        case SimdTier::Sse2:    return "SSE2";
+        case SimdTier::Avx:     return "AVX";
+        case SimdTier::Avx2Fma: return "AVX2+FMA";
+        case SimdTier::Avx512:  return "AVX-512";
+        default:                return "scalar";
+    }
+}
+
+// Escape-time row kernel signatures. Each call computes n consecutive
+// pixels of one row (any n >= 0 — short tails are handled with idle lanes):
+// x0:    real coordinate of pixel column 0
+// scale: complex units per pixel
+// px:    first column; pixel k sits at re = x0 + (px + k) * scale
+// im:    imaginary coordinate of the row
+// out:   receives n smooth iteration values
+using EtFn       = void (*)(double x0, double scale, int px, int n, double im,
+                            int max_iter, double* out);
+using EtJuliaFn  = void (*)(double x0, double scale, int px, int n, double im,
+                            int max_iter, double julia_re, double julia_im,
+                            double* out);
+using EtExpFn    = void (*)(double x0, double scale, int px, int n, double im,
+                            int max_iter, int exp_n, double* out);
+using EtExpJuliaFn = void (*)(double x0, double scale, int px, int n, double im,
+                              int max_iter, int exp_n,
+                              double julia_re, double julia_im, double* out);
+using EtExpfFn   = void (*)(double x0, double scale, int px, int n, double im,
+                            int max_iter, double exp_n, double* out);
+using EtExpfJuliaFn = void (*)(double x0, double scale, int px, int n, double im,
+                               int max_iter, double exp_n,
+                               double julia_re, double julia_im, double* out);
+// Lyapunov dispatch — computes both smooth and lambda.
+// Covers all formula x julia_mode combinations internally.
+using EtLyapunovFn = void (*)(FormulaType formula, bool julia_mode,
+                              double x0, double scale, int px, int n, double im,
+                              int max_iter, int exp_i, double exp_f,
+                              double julia_re, double julia_im,
+                              double* smooth, double* lyap);
+// Double-double dispatch for views just past double resolution, smooth
+// colouring. Coordinates come as hi + lo pairs: pixel k sits at
+// re = (x0_hi + x0_lo) + (px + k) * scale, im = im_hi + im_lo. Covers the
+// degree-2 formulas and integer exponents (exp_n: Mandelbar / Multibrot
+// exponent, integer MultiSlow already promoted).
+using EtDoubleDoubleFn = void (*)(FormulaType formula, bool julia_mode,
+                                  double x0_hi, double x0_lo, double scale, int px, int n,
+                                  double im_hi, double im_lo, int max_iter, int exp_n,
+                                  double julia_re, double julia_im, double* out);
+
+// Integer-exponent kernels (Mandelbar / Multibrot, exp_n >= 3) are
+// instantiated per exponent 3..ET_FIXED_EXP_MAX with z^n as a fixed
+// square-and-multiply chain; slot 0 takes any exponent at runtime, slots 1
+// and 2 are null. Index with et_exp_slot().
+constexpr int ET_FIXED_EXP_MAX = 8;
+template<class Fn>
+using EtExpTable = std::array<Fn, ET_FIXED_EXP_MAX + 1>;
+
+inline int et_exp_slot(int exp_n) { return exp_n <= ET_FIXED_EXP_MAX ? exp_n : 0; }
+
+struct EscapeTimeKernels {
+    int           lanes;                   // SIMD width the kernels stream with
+    int           interleave;              // independent vector groups per loop
+    EtFn          mandelbrot;
+    EtJuliaFn     julia;
+    EtFn          burning_ship;
+    EtJuliaFn     burning_ship_julia;
+    EtFn          mandelbar;
+    EtJuliaFn     mandelbar_julia;
+    EtExpTable<EtExpFn>      mandelbar_multi;         // exp_n >= 3
+    EtExpTable<EtExpJuliaFn> mandelbar_multi_julia;
+    EtExpTable<EtExpFn>      multibrot;               // exp_n >= 3 (n=2 uses mandelbrot)
+    EtExpTable<EtExpJuliaFn> multijulia;
+    EtExpfFn      multibrot_slow;          // real exponent: roots when in eighths, else polar form
+    EtExpfJuliaFn multijulia_slow;
+    EtFn          celtic;                  // |Re(z^2)| + i Im(z^2) + c
+    EtJuliaFn     celtic_julia;
+    EtFn          buffalo;                 // |Re(z^2)| + i|Im(z^2)| + c
+    EtJuliaFn     buffalo_julia;
+    EtFn          collatz;                 // (2+7z-(2+5z)*cos(pi*z))/4
+    EtLyapunovFn  lyapunov;
+    EtDoubleDoubleFn double_double;       // always double lanes
+};
+
+// Newton kernel signature — a row span of n pixels, re = x0 + (px + k) * scale
+// for k in [0, n), computed `lanes` at a time with the tail group masked
+// (n <= any caller's buffer; no minimum).
+// degree:       polynomial degree; the Horner kernels are built for one
+//               degree and ignore it (pick the kernel with newton_kernel())
+// coeffs_re/im: polynomial coefficients [0..degree-1] (leading z^n = 1
+//               implicit; Horner kernels only)
+// roots_re/im:  root positions [0..degree-1]
+// trap_r2:      squared root trap radius (trap kernels only)
+// root:         output[n] — which root each pixel converged to (-1 = none)
+// smooth:       output[n] — iteration count (flat) or smooth count at convergence
+using NewtonFn = void (*)(double x0, double scale, int px, int n, double im,
+                          int max_iter, int degree,
+                          const double* coeffs_re, const double* coeffs_im,
+                          const double* roots_re, const double* roots_im,
+                          double trap_r2, int* root, double* smooth);
+
+// Newton kernels are instantiated per method, polynomial degree (fully
+// unrolled Horner steps, 2..NEWTON_HORNER_DEGREE) and convergence test.
+// Slot 0 holds the product-form kernel for every higher degree; slot 1 is
+// null.
+using NewtonDegreeTable = std::array<NewtonFn, NEWTON_HORNER_DEGREE + 1>;
+
+struct NewtonMethodKernels {
+    NewtonDegreeTable newton;               // flat coloring: integer iteration count
+    NewtonDegreeTable newton_smooth;        // smooth coloring: log-based fractional count
+    NewtonDegreeTable newton_trap;          // ... also stopping inside the root trap
+    NewtonDegreeTable newton_trap_smooth;
+};
+
+struct NewtonKernels {
+    int                 lanes;
+    NewtonMethodKernels method[NEWTON_METHOD_COUNT];   // indexed by NewtonMethod
+};
+
+// The kernel for one render's method, degree, colouring and convergence test
+inline NewtonFn newton_kernel(const NewtonKernels& K, NewtonMethod method, int degree,
+                              bool smooth, bool trap)
+{
+    const NewtonMethodKernels& m = K.method[static_cast<int>(method)];
+    const int slot = degree <= NEWTON_HORNER_DEGREE ? degree : 0;
+    if (trap)
+        return (smooth ? m.newton_trap_smooth : m.newton_trap)[slot];
+    return (smooth ? m.newton_smooth : m.newton)[slot];
+}
+
+// Escape-time kernels are instantiated for interleave factors 1..4: each
+// loop iteration carries that many independent vector groups so their
+// dependency chains overlap. The best factor depends on the CPU's FP
+// latency/throughput ratio — the CLI benchmark sweeps it. Rows are at most
+// TILE_W pixels, so extra groups run dry early; the default is one group.
+constexpr int SIMD_MAX_INTERLEAVE     = 4;
+constexpr int SIMD_DEFAULT_INTERLEAVE = 1;
+
+// One table per tier, interleave factor and periodicity checking on/off,
+// defined in the per-tier objects
+const EscapeTimeKernels& escape_time_kernels_sse2(int interleave, bool periodicity);
+const EscapeTimeKernels& escape_time_kernels_avx(int interleave, bool periodicity);
+const EscapeTimeKernels& escape_time_kernels_avx2(int interleave, bool periodicity);
+const EscapeTimeKernels& escape_time_kernels_avx512(int interleave, bool periodicity);
+
+const NewtonKernels& newton_kernels_sse2();
+const NewtonKernels& newton_kernels_avx();
+const NewtonKernels& newton_kernels_avx2();
+const NewtonKernels& newton_kernels_avx512();
+
+// Single-precision tables: twice the lanes per register, same signatures
+// (coordinates in, results out stay double). Only valid while float
+// rounding of the pixel coordinates is far below one pixel — see
+// CpuRenderer's precision selection. Collatz and double-double entries run
+// in double.
+const EscapeTimeKernels& escape_time_kernels_f32_sse2(int interleave, bool periodicity);
+const EscapeTimeKernels& escape_time_kernels_f32_avx(int interleave, bool periodicity);
+const EscapeTimeKernels& escape_time_kernels_f32_avx2(int interleave, bool periodicity);
+const EscapeTimeKernels& escape_time_kernels_f32_avx512(int interleave, bool periodicity);
+
+const NewtonKernels& newton_kernels_f32_sse2();
+const NewtonKernels& newton_kernels_f32_avx();
+const NewtonKernels& newton_kernels_f32_avx2();
+const NewtonKernels& newton_kernels_f32_avx512();
+
+// Perturbation (deep zoom) row kernel — same span contract as EtFn, but the
+// coordinates are offsets from the reference orbit's point C:
+// dx0: real offset of pixel column 0, dy: imaginary offset of the row.
+// Pixels start at iteration sa.skip from the series approximation (or from
+// start[0 .. n-1] when given) and take BLA steps where valid. Pixels failing
+// the glitch test (|z|^2 < glitch_tol |Z|^2, 0 = off) come out as
+// PERTURB_GLITCH. ref must have been computed for the slot's formula (see
+// PerturbFormula); double lanes on every tier.
+struct ReferenceOrbit;   // perturbation.hpp
+struct SeriesApprox;
+struct BlaTable;
+struct DeepStart;
+using PerturbFn = void (*)(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                           const BlaTable& bla, const DeepStart* start,
+                           double dx0, double scale, int px, int n, double dy,
+                           int max_iter, double glitch_tol, double* out);
+using PerturbExpFn = void (*)(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                              const BlaTable& bla, const DeepStart* start,
+                              double dx0, double scale, int px, int n, double dy,
+                              int max_iter, int exp_n, double glitch_tol, double* out);
+
+// Floatexp lead-in for a row past double range (sa.exp != 0): same span,
+// offsets in units of 2^sa.exp; writes each pixel's hand-over to start[].
+// Mandelbrot only; the other formulas take perturb_lead_in() per pixel.
+using PerturbLeadInFn = void (*)(const ReferenceOrbit& ref, const SeriesApprox& sa,
+                                 double dx0, double scale, int px, int n, double dy,
+                                 int max_iter, DeepStart* start);
+
+struct PerturbationKernels {
+    int             lanes;
+    int             interleave;
+    PerturbFn       mandelbrot;
+    PerturbLeadInFn mandelbrot_lead_in;
+    PerturbFn       burning_ship;
+    PerturbFn       mandelbar;
+    PerturbExpFn    mandelbar_multi;       // exp_n >= 3
+    PerturbExpFn    multibrot;             // exp_n >= 3 (n=2 uses mandelbrot)
+    PerturbFn       celtic;
+    PerturbFn       buffalo;
+};
+
+const PerturbationKernels& perturbation_kernels_sse2(int interleave);
+const PerturbationKernels& perturbation_kernels_avx(int interleave);
+const PerturbationKernels& perturbation_kernels_avx2(int interleave);
+const PerturbationKernels& perturbation_kernels_avx512(int interleave);
@@ -271,7 +271,7 @@ static void draw_newton_tab(AppState& app, const ImGuiIO& io)
     {
         int deg = app.vs.newton_degree;
         ImGui::SetNextItemWidth(-1.0f);
-        if (ImGui::SliderInt("##ndeg", &deg, 2, 8)) {
+        if (ImGui::SliderInt("##ndeg", &deg, 2, NEWTON_MAX_DEGREE)) {
             app.vs.newton_degree = deg;
             newton_init_roots(app.vs);
             app.dirty = true;
@@ -293,6 +293,27 @@ static void draw_newton_tab(AppState& app, const ImGuiIO& io)
         }
     }
 
+    // --- Convergence ---
+    ImGui::Spacing();
+    ImGui::TextDisabled("CONVERGENCE");
+    ImGui::Separator();
+    {
+        static const char* method_names[NEWTON_METHOD_COUNT] = {
+            "Newton (order 2)", "Halley (order 3)", "Householder (order 4)"
+        };
+        int m = static_cast<int>(app.vs.newton_method);
+        ImGui::SetNextItemWidth(-1.0f);
+        if (ImGui::Combo("##newton_method", &m, method_names, NEWTON_METHOD_COUNT)) {
+            app.vs.newton_method = static_cast<NewtonMethod>(m);
+            app.dirty = true;
+            app.mini_dirty = true;
+        }
+    }
+    if (ImGui::Checkbox("Root trap", &app.vs.newton_root_trap)) {
+        app.dirty = true;
+        app.mini_dirty = true;
+    }
+
     // --- Minimap showing Newton fractal with draggable roots ---
     ImGui::Spacing();
     ImGui::TextDisabled("ROOTS");
@@ -331,15 +352,14 @@ static void draw_newton_tab(AppState& app, const ImGuiIO& io)
         mini_vs.view_width      = app.mini_vw;
         mini_vs.max_iter        = 128;
         mini_vs.newton_degree   = app.vs.newton_degree;
-        for (int k = 0; k < 8; ++k) {
-            mini_vs.newton_roots_re[k]  = app.vs.newton_roots_re[k];
-            mini_vs.newton_roots_im[k]  = app.vs.newton_roots_im[k];
-        }
-        for (int k = 0; k < 9; ++k) {
-            mini_vs.newton_coeffs_re[k] = app.vs.newton_coeffs_re[k];
-            mini_vs.newton_coeffs_im[k] = app.vs.newton_coeffs_im[k];
-        }
+        mini_vs.newton_roots_re     = app.vs.newton_roots_re;
+        mini_vs.newton_roots_im     = app.vs.newton_roots_im;
+        mini_vs.newton_coeffs_re    = app.vs.newton_coeffs_re;
+        mini_vs.newton_coeffs_im    = app.vs.newton_coeffs_im;
         mini_vs.newton_coeffs_dirty = false;
+        mini_vs.newton_method       = app.vs.newton_method;
+        mini_vs.newton_root_trap    = app.vs.newton_root_trap;
+        mini_vs.newton_trap_r2      = app.vs.newton_trap_r2;
         app.mini_pbuf.resize(map_iw, map_ih);
         app.renderer.render(mini_vs, app.mini_pbuf);
         app.mini_tex.ensure(map_iw, map_ih);
@@ -363,7 +383,7 @@ static void draw_newton_tab(AppState& app, const ImGuiIO& io)
             const float ry = map_tl.y
                 + static_cast<float>((app.vs.newton_roots_im[k] - app.mini_cy) / map_scale)
                 + map_h * 0.5f;
-            const uint32_t col = NEWTON_ROOT_COLORS[k & 7];
+            const uint32_t col = newton_root_color(k);
             // Convert from our pixel format (0xAABBGGRR) to ImGui IM_COL32 (0xAABBGGRR) — same!
             dl->AddCircleFilled(ImVec2(rx, ry), 5.0f, col);
             dl->AddCircle(ImVec2(rx, ry), 6.5f, IM_COL32(255, 255, 255, 200), 0, 1.5f);
@@ -461,13 +481,19 @@ void draw_side_panel(AppState& app, const ImGuiIO& io, float menu_h, float fh)
     ImGui::TextDisabled("ITERATIONS");
     ImGui::Separator();
     {
+        // A count above the current cap (left over from a deep view) widens
+        // the range rather than being clamped by it
         int iter = app.vs.max_iter;
         ImGui::SetNextItemWidth(-1.0f);
-        if (ImGui::SliderInt("##iter", &iter, 64, 8192, "%d",
+        if (ImGui::SliderInt("##iter", &iter, ITER_MIN, std::max(iter_limit(app), iter), "%d",
                              ImGuiSliderFlags_Logarithmic)) {
             app.vs.max_iter = iter;
             app.dirty = true;
         }
+        // Stop interior orbits once they cycle (escape-time, smooth colouring)
+        if (app.vs.mode == FractalMode::EscapeTime &&
+            ImGui::Checkbox("Periodicity check", &app.vs.periodicity))
+            app.dirty = true;
     }
 
     // --- Shared: Navigation coordinates ---
@@ -477,16 +503,24 @@ void draw_side_panel(AppState& app, const ImGuiIO& io, float menu_h, float fh)
     {
         const float input_w = PANEL_WIDTH - 60.0f;
         ImGui::SetNextItemWidth(input_w);
-        if (ImGui::InputDouble("Re", &app.vs.center_x, 0.0, 0.0, "%.12g"))
+        // A typed coordinate replaces the deep-zoom remainder as well
+        if (ImGui::InputDouble("Re", &app.vs.center_x, 0.0, 0.0, "%.12g")) {
+            app.vs.center_x_lo = BigFix{};
             app.dirty = true;
+        }
         ImGui::SetNextItemWidth(input_w);
-        if (ImGui::InputDouble("Im", &app.vs.center_y, 0.0, 0.0, "%.12g"))
+        if (ImGui::InputDouble("Im", &app.vs.center_y, 0.0, 0.0, "%.12g")) {
+            app.vs.center_y_lo = BigFix{};
             app.dirty = true;
+        }
         ImGui::SetNextItemWidth(input_w);
         if (ImGui::InputDouble("W", &app.vs.view_width, 0.0, 0.0, "%.6g")) {
-            if (app.vs.view_width < 1e-15) app.vs.view_width = 1e-15;
+            view_set_width(app.vs, app.vs.view_width);
             app.dirty = true;
         }
+        // Past double range the field holds the width's mantissa part
+        if (app.vs.view_exp != 0)
+            ImGui::TextDisabled("W x 2^%d", app.vs.view_exp);
     }
 
     ImGui::End();  // ##panel
@@ -622,12 +656,13 @@ void draw_benchmark_dialog(AppState& app)
         // Per-run state (static -- persists across frames while modal is open)
         static bool   bench_running  = false;
         static bool   bench_done     = false;
-        static int    bench_phase    = 0;   // 0=AVX, 1=scalar
+        static int    bench_phase    = 0;   // 0=best SIMD tier, 1=scalar
         static int    bench_ti       = 0;   // thread index 0-based
         static int    bench_rep      = 0;   // repetition 0-3
         static double bench_sum      = 0.0;
         static int    bench_saved_tc = 0;   // saved thread count
-        static bool   bench_saved_a = false;
+        static SimdTier bench_saved_tier = SimdTier::Scalar;
+        static Precision bench_saved_prec = Precision::Auto;
         static std::vector<float> bench_avx;
         static std::vector<float> bench_scalar;
         static PixelBuffer bench_buf;
@@ -635,7 +670,7 @@ void draw_benchmark_dialog(AppState& app)
         // One render step per frame while running
         if (bench_running) {
             app.renderer.set_thread_count(bench_ti + 1);
-            app.renderer.set_avx(bench_phase == 0);
+            app.renderer.set_simd(bench_phase == 0);
 
             ViewState bvs;   // Mandelbrot, center (-0.5,0), width 3.5, 256 iter
             bvs.center_x   = -0.5;
@@ -662,7 +697,8 @@ void draw_benchmark_dialog(AppState& app)
                         bench_running = false;
                         bench_done    = true;
                         app.renderer.set_thread_count(bench_saved_tc);
-                        app.renderer.set_avx(bench_saved_a);
+                        app.renderer.set_tier(bench_saved_tier);
+                        app.renderer.set_precision(bench_saved_prec);
                         app.dirty = true;  // restore main view
                     }
                 }
@@ -680,7 +716,9 @@ void draw_benchmark_dialog(AppState& app)
                 bench_sum     = 0.0;
                 bench_done    = false;
                 bench_saved_tc = app.renderer.thread_count;
-                bench_saved_a = app.renderer.avx_active;
+                bench_saved_tier = app.renderer.tier();
+                bench_saved_prec = app.renderer.precision();
+                app.renderer.set_precision(Precision::Double);   // compare like for like
                 bench_running  = true;
             }
         } else {
@@ -697,7 +735,8 @@ void draw_benchmark_dialog(AppState& app)
             char prog[64];
             if (bench_running)
                 snprintf(prog, sizeof(prog), "%s  %d/%d threads  rep %d/4",
-                         bench_phase == 0 ? "AVX" : "Scalar",
+                         bench_phase == 0 ? simd_tier_name(app.renderer.best_tier())
+                                          : "Scalar",
                          bench_ti + 1, hw, bench_rep + 1);
             else
                 snprintf(prog, sizeof(prog), "Done");
@@ -706,7 +745,7 @@ void draw_benchmark_dialog(AppState& app)
                                ImVec2(-1.0f, 0.0f));
         }
 
-        // Chart -- overlay AVX (blue) and Scalar (orange) on same area
+        // Chart -- overlay SIMD (blue) and Scalar (orange) on same area
         if ((bench_running && (bench_phase > 0 || bench_ti > 0)) || bench_done) {
             ImGui::Spacing();
             ImGui::Separator();
@@ -723,10 +762,11 @@ void draw_benchmark_dialog(AppState& app)
             }
             y_max *= 1.1f;  // 10% headroom
 
-            // AVX chart
+            // SIMD chart (best tier the CPU supports)
             char avx_lbl[48], scalar_lbl[48];
             snprintf(avx_lbl,    sizeof(avx_lbl),
-                     "AVX  (Mpix/s, 1..%d threads)", hw);
+                     "%s  (Mpix/s, 1..%d threads)",
+                     simd_tier_name(app.renderer.best_tier()), hw);
             snprintf(scalar_lbl, sizeof(scalar_lbl),
                      "Scalar(Mpix/s, 1..%d threads)", hw);
 
@@ -753,7 +793,8 @@ void draw_benchmark_dialog(AppState& app)
             if (bench_running) {
                 bench_running = false;
                 app.renderer.set_thread_count(bench_saved_tc);
-                app.renderer.set_avx(bench_saved_a);
+                app.renderer.set_tier(bench_saved_tier);
+                app.renderer.set_precision(bench_saved_prec);
                 app.dirty = true;
             }
             ImGui::CloseCurrentPopup();
@@ -1,11 +1,44 @@
 #pragma once
 
+#include "aligned_vector.hpp"
+#include "bigfix.hpp"
+#include "ddouble.hpp"
+
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 
 // Top-level fractal family discriminator
 enum class FractalMode { EscapeTime = 0, Newton = 1 };
 
+// Root-finding iteration of Newton mode, by order of convergence
+enum class NewtonMethod {
+    Newton      = 0,  // z - p/p'                       (quadratic)
+    Halley      = 1,  // z - 2pp' / (2p'^2 - pp'')      (cubic)
+    Householder = 2,  // third-order Householder, p'''  (quartic)
+};
+constexpr int NEWTON_METHOD_COUNT = 3;
+
+inline const char* newton_method_name(NewtonMethod m)
+{
+    switch (m) {
+        case NewtonMethod::Halley:      return "Halley";
+        case NewtonMethod::Householder: return "Householder";
+        default:                        return "Newton";
+    }
+}
+
+// Convergence order of each method
+inline int newton_method_order(NewtonMethod m) { return static_cast<int>(m) + 2; }
+
+// Newton polynomials up to this degree are evaluated in expanded Horner
+// form with per-degree unrolled kernels; higher degrees (up to
+// NEWTON_MAX_DEGREE in the UI) use the product form over the roots, whose
+// cost is linear in the degree and which stays accurate where the expanded
+// coefficients would cancel catastrophically.
+constexpr int NEWTON_HORNER_DEGREE = 8;
+constexpr int NEWTON_MAX_DEGREE    = 64;
+
 enum class FormulaType {
     Standard    = 0,  // z^2 + c  (always degree 2, no exponent slider)
     BurningShip = 1,  // (|Re z| + i|Im z|)^2 + c
@@ -18,6 +51,21 @@ enum class FormulaType {
 };
 constexpr int FORMULA_COUNT = 8;
 
+// MultiSlow exponents that are a non-integer multiple of 1/8 (1.5, 2.25,
+// 3.5, -0.5, ...) skip the polar form: z^r = z^whole * z^(eighths/8), the
+// integer power by square-and-multiply and the fraction by at most three
+// principal square roots, which stay on the polar form's branch
+// (arg z in (-pi, pi]). A negative r takes the reciprocal.
+// Returns round(|r| * 8) — whole = q >> 3, eighths = q & 7 — or 0 when r is
+// not of that form.
+inline int multislow_eighths(double r)
+{
+    const double a = std::abs(r) * 8.0;
+    if (!(a < 8192.0)) return 0;
+    const int q = static_cast<int>(std::lround(a));
+    return (q % 8 != 0 && std::abs(a - q) < 8e-9) ? q : 0;
+}
+
 enum ColorMode {
     COLOR_SMOOTH            = 0,
     COLOR_LYAPUNOV_INTERIOR = 1,
@@ -25,10 +73,43 @@ enum ColorMode {
 };
 constexpr int COLOR_MODE_COUNT = 3;
 
+// Periodicity checking (Brent): the orbit point is saved at iterations
+// 1, 2, 4, 8, ...; an orbit that comes back within sqrt(eps2) of the saved
+// point has fallen into a cycle and the pixel is interior.
+constexpr double PERIODICITY_EPS2     = 1e-24;
+constexpr double PERIODICITY_EPS2_F32 = 1e-12;   // float kernels
+
+// The radius the kernels actually use at pixel spacing scale: eps2, capped
+// at 1/256 of a pixel. An escaping orbit near a minibrot can shadow that
+// minibrot's cycle to well under a pixel for thousands of iterations, and
+// at deep zoom the fixed radius would call it interior.
+inline double periodicity_eps2(double scale, double eps2 = PERIODICITY_EPS2)
+{
+    const double r = scale * (1.0 / 256);
+    return std::min(eps2, r * r);
+}
+
+// Narrowest view width navigation allows, as a power of two (~1e-421):
+// the reference orbit's BigFix still resolves the pixels with guard bits.
+constexpr int MIN_VIEW_WIDTH_LOG2 = -1400;
+
+// view_width stays at or above this; narrower views carry the rest of the
+// width in view_exp (and render with FloatExp pixel deltas)
+constexpr double VIEW_EXP_THRESHOLD = 0x1p-900;
+
 struct ViewState {
     double      center_x        =  0.0;
     double      center_y        =  0.0;
-    double      view_width      =  4.0;  // width of viewport in complex-plane units
+    double      view_width      =  4.0;  // width of viewport in complex-plane units (x 2^view_exp)
+    // Deep zoom: binary exponent of the width past VIEW_EXP_THRESHOLD, 0
+    // above it. Offsets derived from view_width (view_pan) are in the same
+    // units; change the width with view_set_width() to keep it normalized.
+    int         view_exp        =  0;
+    // Deep zoom: the exact centre is center_x + center_x_lo (likewise y).
+    // center_x is the nearest double, the BigFix holds what it cannot;
+    // move the centre with view_pan() so neither part is lost.
+    BigFix      center_x_lo;
+    BigFix      center_y_lo;
     int         max_iter        =  256;
     FormulaType formula         =  FormulaType::Standard;
     bool        julia_mode      =  false;
@@ -39,30 +120,98 @@ struct ViewState {
     int         multibrot_exp   =  2;    // integer exponent for Mandelbar/MultiFast (2-8)
     double      multibrot_exp_f =  3.0;  // float exponent for MultiSlow
     int         color_mode      =  0;    // ColorMode: 0=smooth, 1=lyap interior, 2=lyap full
+    bool        periodicity     =  true; // retire cycling interior orbits early (smooth colouring)
 
     // Top-level mode
     FractalMode mode            =  FractalMode::EscapeTime;
 
     // Newton-specific fields (only meaningful when mode == Newton)
-    int         newton_degree        = 3;       // 2-8
-    double      newton_roots_re[8]   = {};      // root positions (complex)
-    double      newton_roots_im[8]   = {};
-    double      newton_coeffs_re[9]  = {};      // expanded polynomial coefficients (cached)
-    double      newton_coeffs_im[9]  = {};      // coeffs[k] = coeff of z^k; leading z^n = 1 implicit
+    int         newton_degree        = 3;       // 2-NEWTON_MAX_DEGREE
+    // Root positions (newton_degree of each) and, up to NEWTON_HORNER_DEGREE,
+    // the cached expanded coefficients: coeffs[k] = coeff of z^k, leading
+    // z^n = 1 implicit
+    AlignedVector<double> newton_roots_re = AlignedVector<double>(3);
+    AlignedVector<double> newton_roots_im = AlignedVector<double>(3);
+    AlignedVector<double> newton_coeffs_re;
+    AlignedVector<double> newton_coeffs_im;
     bool        newton_coeffs_dirty  = true;
+    NewtonMethod newton_method       = NewtonMethod::Newton;
+    bool        newton_root_trap     = false;   // also converge on entering a root's trap radius
+    double      newton_trap_r2       = 0.0;     // (half the smallest root spacing)^2 (cached)
 };
 
+// Exact (high-precision) centre coordinates
+inline BigFix view_center_re(const ViewState& vs) { return BigFix(vs.center_x) + vs.center_x_lo; }
+inline BigFix view_center_im(const ViewState& vs) { return BigFix(vs.center_y) + vs.center_y_lo; }
+
+// Centre as double-double (~106 bits): the double-double kernels' pixel
+// coordinates are offsets from it
+inline DDouble view_center_re_dd(const ViewState& vs) { return { vs.center_x, vs.center_x_lo.to_double() }; }
+inline DDouble view_center_im_dd(const ViewState& vs) { return { vs.center_y, vs.center_y_lo.to_double() }; }
+
+// Width in complex-plane units (0 once it underflows a double)
+inline double true_view_width(const ViewState& vs) { return std::ldexp(vs.view_width, vs.view_exp); }
+
+// Set the width to w * 2^view_exp, clamped to MIN_VIEW_WIDTH_LOG2, and move
+// the exponent between view_width and view_exp (up to 64 bits at a time)
+// so that view_width stays in [VIEW_EXP_THRESHOLD, VIEW_EXP_THRESHOLD * 2^64)
+// while view_exp is non-zero.
+inline void view_set_width(ViewState& vs, double w)
+{
+    vs.view_width = w;
+    if (!(w > 0.0) || std::ilogb(w) + vs.view_exp < MIN_VIEW_WIDTH_LOG2) {
+        vs.view_width = 1.0;
+        vs.view_exp   = MIN_VIEW_WIDTH_LOG2;
+    }
+    while (vs.view_width < VIEW_EXP_THRESHOLD) {
+        vs.view_width *= 0x1p64;
+        vs.view_exp   -= 64;
+    }
+    while (vs.view_exp < 0 && vs.view_width >= VIEW_EXP_THRESHOLD * 0x1p64) {
+        const int k = std::min(-vs.view_exp, 64);
+        vs.view_width = std::ldexp(vs.view_width, -k);
+        vs.view_exp  += k;
+    }
+}
+
+// Move the centre by (dx, dy) * 2^view_exp complex-plane units without
+// losing the digits below double precision, then split it back into
+// double + remainder.
+inline void view_pan(ViewState& vs, double dx, double dy)
+{
+    const BigFix re = view_center_re(vs) + BigFix(dx, vs.view_exp);
+    const BigFix im = view_center_im(vs) + BigFix(dy, vs.view_exp);
+    vs.center_x    = re.to_double();
+    vs.center_y    = im.to_double();
+    vs.center_x_lo = re - BigFix(vs.center_x);
+    vs.center_y_lo = im - BigFix(vs.center_y);
+}
+
 inline double zoom_display(const ViewState& vs)
 {
     return 4.0 / vs.view_width;
 }
 
+// Zoom as text: "%.4f" up to 1e15, "<m>e<exp>" for deeper views (also past
+// double range)
+inline void zoom_text(const ViewState& vs, char* buf, size_t size)
+{
+    if (vs.view_exp == 0 && zoom_display(vs) < 1e15) {
+        std::snprintf(buf, size, "%.4f", zoom_display(vs));
+        return;
+    }
+    const double lg = std::log10(zoom_display(vs)) - vs.view_exp * std::log10(2.0);
+    const double ex = std::floor(lg);
+    std::snprintf(buf, size, "%.4fe%.0f", std::pow(10.0, lg - ex), ex);
+}
+
 // Returns a human-readable name combining formula and Julia mode.
 inline const char* fractal_name(const ViewState& vs)
 {
     if (vs.mode == FractalMode::Newton) {
         static char newton_buf[32];
-        std::snprintf(newton_buf, sizeof(newton_buf), "Newton (deg %d)", vs.newton_degree);
+        std::snprintf(newton_buf, sizeof(newton_buf), "%s (deg %d)",
+                      newton_method_name(vs.newton_method), vs.newton_degree);
         return newton_buf;
     }
     switch (vs.formula) {
@@ -103,14 +252,17 @@ inline void reset_view_keep_params(ViewState& vs, FormulaType new_formula, bool
     const double      mexpf = vs.multibrot_exp_f;
     const int         iter  = vs.max_iter;
     const int         cmode = vs.color_mode;
+    const bool        period = vs.periodicity;
     const FractalMode mode  = vs.mode;
 
     // Preserve Newton state across resets
     const int    ndeg = vs.newton_degree;
-    double       nrre[8], nrim[8], ncre[9], ncim[9];
-    for (int i = 0; i < 8; ++i) { nrre[i] = vs.newton_roots_re[i]; nrim[i] = vs.newton_roots_im[i]; }
-    for (int i = 0; i < 9; ++i) { ncre[i] = vs.newton_coeffs_re[i]; ncim[i] = vs.newton_coeffs_im[i]; }
+    AlignedVector<double> nrre = std::move(vs.newton_roots_re),  nrim = std::move(vs.newton_roots_im);
+    AlignedVector<double> ncre = std::move(vs.newton_coeffs_re), ncim = std::move(vs.newton_coeffs_im);
     const bool   ncdirty = vs.newton_coeffs_dirty;
+    const NewtonMethod nmethod = vs.newton_method;
+    const bool   ntrap   = vs.newton_root_trap;
+    const double ntrap2  = vs.newton_trap_r2;
 
     vs                = default_view_for(new_formula);
     vs.formula        = new_formula;
@@ -123,12 +275,18 @@ inline void reset_view_keep_params(ViewState& vs, FormulaType new_formula, bool
     vs.multibrot_exp_f = mexpf;
     vs.max_iter       = iter;
     vs.color_mode     = cmode;
+    vs.periodicity    = period;
     vs.mode           = mode;
 
     vs.newton_degree  = ndeg;
-    for (int i = 0; i < 8; ++i) { vs.newton_roots_re[i] = nrre[i]; vs.newton_roots_im[i] = nrim[i]; }
-    for (int i = 0; i < 9; ++i) { vs.newton_coeffs_re[i] = ncre[i]; vs.newton_coeffs_im[i] = ncim[i]; }
+    vs.newton_roots_re  = std::move(nrre);
+    vs.newton_roots_im  = std::move(nrim);
+    vs.newton_coeffs_re = std::move(ncre);
+    vs.newton_coeffs_im = std::move(ncim);
     vs.newton_coeffs_dirty = ncdirty;
+    vs.newton_method       = nmethod;
+    vs.newton_root_trap    = ntrap;
+    vs.newton_trap_r2      = ntrap2;
 }
 
 // Place newton_degree roots evenly on the unit circle.
@@ -136,60 +294,71 @@ inline void newton_init_roots(ViewState& vs)
 {
     const int n = vs.newton_degree;
     const double two_pi = 2.0 * 3.14159265358979323846;
+    vs.newton_roots_re.resize(n);
+    vs.newton_roots_im.resize(n);
     for (int k = 0; k < n; ++k) {
         const double angle = two_pi * k / n;
         vs.newton_roots_re[k] = std::cos(angle);
         vs.newton_roots_im[k] = std::sin(angle);
     }
-    // Zero out unused root slots
-    for (int k = n; k < 8; ++k) {
-        vs.newton_roots_re[k] = 0.0;
-        vs.newton_roots_im[k] = 0.0;
-    }
     vs.newton_coeffs_dirty = true;
 }
 
 // Expand product(z - r_k) into polynomial coefficients using incremental algorithm.
 // coeffs[k] = coefficient of z^k for k=0..degree-1; leading z^degree = 1 (implicit).
+// Only up to NEWTON_HORNER_DEGREE — past it the coefficients are left empty.
+// Also caches the root trap radius: half the smallest distance between two
+// roots, so the traps never overlap.
 inline void newton_expand_roots(ViewState& vs)
 {
     const int n = vs.newton_degree;
-    // Start with (z - r_0): coeffs = [-r_0], leading z^1 = 1
-    // We store coeffs[0..n-1]; coeffs[k] is the coefficient of z^k.
-    // The leading z^n coefficient is always 1 (implicit).
+    vs.newton_coeffs_re.clear();
+    vs.newton_coeffs_im.clear();
+    if (n <= NEWTON_HORNER_DEGREE) {
+        // Start with (z - r_0): coeffs = [-r_0], leading z^1 = 1
+        // We store coeffs[0..n-1]; coeffs[k] is the coefficient of z^k.
+        // The leading z^n coefficient is always 1 (implicit).
 
-    // Initialize: polynomial = 1 (constant)
-    double pre[9] = {}, pim[9] = {};
-    pre[0] = 1.0; pim[0] = 0.0;  // p(z) = 1
-    int deg = 0;
+        // Initialize: polynomial = 1 (constant)
+        double pre[NEWTON_HORNER_DEGREE + 1] = {}, pim[NEWTON_HORNER_DEGREE + 1] = {};
+        pre[0] = 1.0; pim[0] = 0.0;  // p(z) = 1
+        int deg = 0;
 
-    for (int k = 0; k < n; ++k) {
-        // Multiply by (z - r_k):  new_p = p * z - p * r_k
-        const double rr = vs.newton_roots_re[k];
-        const double ri = vs.newton_roots_im[k];
-
-        // Shift up (multiply by z) and subtract r_k * old
-        double nre[9] = {}, nim[9] = {};
-        // z * p: shift coefficients up by 1
-        for (int j = deg; j >= 0; --j) {
-            nre[j + 1] += pre[j];
-            nim[j + 1] += pim[j];
-        }
-        // Subtract r_k * p
-        for (int j = 0; j <= deg; ++j) {
-            // (a+bi)(c+di) = (ac-bd) + (ad+bc)i
-            nre[j] -= pre[j] * rr - pim[j] * ri;
-            nim[j] -= pre[j] * ri + pim[j] * rr;
+        for (int k = 0; k < n; ++k) {
+            // Multiply by (z - r_k):  new_p = p * z - p * r_k
+            const double rr = vs.newton_roots_re[k];
+            const double ri = vs.newton_roots_im[k];
+
+            // Shift up (multiply by z) and subtract r_k * old
+            double nre[NEWTON_HORNER_DEGREE + 1] = {}, nim[NEWTON_HORNER_DEGREE + 1] = {};
+            // z * p: shift coefficients up by 1
+            for (int j = deg; j >= 0; --j) {
+                nre[j + 1] += pre[j];
+                nim[j + 1] += pim[j];
+            }
+            // Subtract r_k * p
+            for (int j = 0; j <= deg; ++j) {
+                // (a+bi)(c+di) = (ac-bd) + (ad+bc)i
+                nre[j] -= pre[j] * rr - pim[j] * ri;
+                nim[j] -= pre[j] * ri + pim[j] * rr;
+            }
+            deg++;
+            for (int j = 0; j <= deg; ++j) { pre[j] = nre[j]; pim[j] = nim[j]; }
         }
-        deg++;
-        for (int j = 0; j <= deg; ++j) { pre[j] = nre[j]; pim[j] = nim[j]; }
-    }
 
-    // Now pre[0..n] has the full polynomial with pre[n] = 1.0 (leading).
-    // Store coeffs[0..n-1] (everything except the leading z^n term).
-    for (int k = 0; k < n; ++k) {
-        vs.newton_coeffs_re[k] = pre[k];
-        vs.newton_coeffs_im[k] = pim[k];
+        // Now pre[0..n] has the full polynomial with pre[n] = 1.0 (leading).
+        // Store coeffs[0..n-1] (everything except the leading z^n term).
+        vs.newton_coeffs_re.assign(pre, pre + n);
+        vs.newton_coeffs_im.assign(pim, pim + n);
     }
+
+    double min_d2 = 1e30;
+    for (int j = 0; j < n; ++j)
+        for (int k = j + 1; k < n; ++k) {
+            const double dx = vs.newton_roots_re[j] - vs.newton_roots_re[k];
+            const double dy = vs.newton_roots_im[j] - vs.newton_roots_im[k];
+            min_d2 = std::min(min_d2, dx * dx + dy * dy);
+        }
+    vs.newton_trap_r2 = 0.25 * min_d2;
     vs.newton_coeffs_dirty = false;
 }